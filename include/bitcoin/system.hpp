@@ -34,6 +34,8 @@
 #include <bitcoin/system/warnings.hpp>
 #include <bitcoin/system/chain/annex.hpp>
 #include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/chain/block_file.hpp>
+#include <bitcoin/system/chain/block_parser.hpp>
 #include <bitcoin/system/chain/chain.hpp>
 #include <bitcoin/system/chain/chain_state.hpp>
 #include <bitcoin/system/chain/checkpoint.hpp>
@@ -50,6 +52,7 @@
 #include <bitcoin/system/chain/taproot.hpp>
 #include <bitcoin/system/chain/tapscript.hpp>
 #include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/chain/wire_scanner.hpp>
 #include <bitcoin/system/chain/witness.hpp>
 #include <bitcoin/system/chain/enums/coverage.hpp>
 #include <bitcoin/system/chain/enums/extension.hpp>
@@ -102,9 +105,12 @@
 #include <bitcoin/system/data/data_slice.hpp>
 #include <bitcoin/system/data/exclusive_slice.hpp>
 #include <bitcoin/system/data/external_ptr.hpp>
+#include <bitcoin/system/data/inline_vector.hpp>
 #include <bitcoin/system/data/iterable.hpp>
 #include <bitcoin/system/data/memory.hpp>
 #include <bitcoin/system/data/no_fill_allocator.hpp>
+#include <bitcoin/system/data/once_cache.hpp>
+#include <bitcoin/system/data/ring_buffer.hpp>
 #include <bitcoin/system/data/string.hpp>
 #include <bitcoin/system/endian/batch.hpp>
 #include <bitcoin/system/endian/endian.hpp>
@@ -170,7 +176,9 @@
 #include <bitcoin/system/machine/number_boolean.hpp>
 #include <bitcoin/system/machine/number_chunk.hpp>
 #include <bitcoin/system/machine/number_integer.hpp>
+#include <bitcoin/system/machine/profiler.hpp>
 #include <bitcoin/system/machine/program.hpp>
+#include <bitcoin/system/machine/rules.hpp>
 #include <bitcoin/system/machine/stack.hpp>
 #include <bitcoin/system/math/addition.hpp>
 #include <bitcoin/system/math/bits.hpp>
@@ -187,6 +195,7 @@
 #include <bitcoin/system/math/power.hpp>
 #include <bitcoin/system/math/rotate.hpp>
 #include <bitcoin/system/math/sign.hpp>
+#include <bitcoin/system/math/uint256.hpp>
 #include <bitcoin/system/radix/base_10.hpp>
 #include <bitcoin/system/radix/base_16.hpp>
 #include <bitcoin/system/radix/base_2048.hpp>
@@ -204,6 +213,7 @@
 #include <bitcoin/system/stream/device.hpp>
 #include <bitcoin/system/stream/make_stream.hpp>
 #include <bitcoin/system/stream/make_streamer.hpp>
+#include <bitcoin/system/stream/mapped_file.hpp>
 #include <bitcoin/system/stream/stream.hpp>
 #include <bitcoin/system/stream/stream_result.hpp>
 #include <bitcoin/system/stream/streamers.hpp>
@@ -224,6 +234,11 @@
 #include <bitcoin/system/stream/streamers/sha256_writer.hpp>
 #include <bitcoin/system/stream/streamers/sha256t_writer.hpp>
 #include <bitcoin/system/stream/streamers/sha256x2_writer.hpp>
+#include <bitcoin/system/stream/streamers/slab_writer.hpp>
+#include <bitcoin/system/stream/streamers/slice_reader.hpp>
+#include <bitcoin/system/stream/streamers/tee_writer.hpp>
+#include <bitcoin/system/stream/streamers/word_bit_reader.hpp>
+#include <bitcoin/system/stream/streamers/word_bit_writer.hpp>
 #include <bitcoin/system/stream/streamers/interfaces/bitflipper.hpp>
 #include <bitcoin/system/stream/streamers/interfaces/bitreader.hpp>
 #include <bitcoin/system/stream/streamers/interfaces/bitwriter.hpp>
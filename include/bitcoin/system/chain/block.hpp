@@ -24,6 +24,7 @@
 #include <bitcoin/system/chain/context.hpp>
 #include <bitcoin/system/chain/header.hpp>
 #include <bitcoin/system/chain/input.hpp>
+#include <bitcoin/system/chain/taproot.hpp>
 #include <bitcoin/system/chain/transaction.hpp>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
@@ -60,6 +61,8 @@ public:
     block(std::istream& stream, bool witness) NOEXCEPT;
     block(reader&& source, bool witness) NOEXCEPT;
     block(reader& source, bool witness) NOEXCEPT;
+    block(slice_reader&& source, bool witness) NOEXCEPT;
+    block(slice_reader& source, bool witness) NOEXCEPT;
 
     /// Operators.
     /// -----------------------------------------------------------------------
@@ -73,6 +76,7 @@ public:
     data_chunk to_data(bool witness) const NOEXCEPT;
     void to_data(std::ostream& stream, bool witness) const NOEXCEPT;
     void to_data(writer& sink, bool witness) const NOEXCEPT;
+    void to_data(slab_writer& sink, bool witness) const NOEXCEPT;
 
     /// Properties.
     /// -----------------------------------------------------------------------
@@ -108,12 +112,12 @@ public:
 
     /// Cache and metadata.
     /// -----------------------------------------------------------------------
-    /// getters/setters, const/mutable, not thread safe.
+    /// getters/setters, const/mutable, setters not thread safe.
 
     /// Cache (overrides hash() computation).
-    void set_hashes(const data_chunk& data) NOEXCEPT;
+    void set_hashes(const data_slice& data) NOEXCEPT;
 
-    /// Reference used to avoid copy, sets cache if not set.
+    /// Reference used to avoid copy, sets cache if not set (thread safe).
     const hash_digest& get_hash() const NOEXCEPT;
 
     /// Set/get chain_state associated with the block.header, may be nullptr.
@@ -196,10 +200,21 @@ protected:
     /// Requires input.metadata.spent (prevout confirmation).
     bool is_unspent_coinbase_collision() const NOEXCEPT;
 
+    /// Connect (contextual).
+    /// -----------------------------------------------------------------------
+
+    /// Requires prevouts (script), batch verifies taproot script-path
+    /// commitments, with the spending input of each in out_owners [bip341].
+    void verify_commitments(taproot::commitments& out_batch,
+        std_vector<const input*>& out_owners) const NOEXCEPT;
+
 private:
     typedef struct { size_t nominal; size_t witnessed; } sizes;
 
-    void assign_data(reader& source, bool witness) NOEXCEPT;
+    template <typename Sink>
+    void serialize(Sink& sink, bool witness) const NOEXCEPT;
+    template <typename Source>
+    void assign_data(Source& source, bool witness) NOEXCEPT;
     static block from_data(reader& source, bool witness) NOEXCEPT;
     static sizes serialized_size(const transaction_cptrs& txs) NOEXCEPT;
 
@@ -0,0 +1,103 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_CHAIN_BLOCK_FILE_HPP
+#define LIBBITCOIN_SYSTEM_CHAIN_BLOCK_FILE_HPP
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <vector>
+#include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+/// Import of a framed block file (e.g. blk*.dat or a bootstrap file), in which
+/// each block is preceded by the four byte network magic and its four byte
+/// little-endian size. Blocks are deserialized, hashed and checked across a
+/// set of worker threads, and emitted in file order (which is height order
+/// for bootstrap files) through a bounded reorder buffer.
+class BC_API block_file
+{
+public:
+    DELETE_COPY_MOVE_DESTRUCT(block_file);
+
+    /// Block byte range within the file.
+    struct frame
+    {
+        size_t offset;
+        size_t size;
+    };
+
+    typedef std::vector<frame> frames;
+
+    /// Invoked from the importing thread in frame order. The block is nullptr
+    /// (with error::invalid_frame) if it does not deserialize to the frame
+    /// size, otherwise ec is the result of block.check(). Return false to
+    /// stop the import.
+    typedef std::function<bool(const code& ec,
+        const block::cptr& block)> handler;
+
+    /// Frame boundaries, ending at zero padding or a mismatched/truncated
+    /// frame (as may follow a partial write).
+    static frames scan(const data_slice& file, uint32_t magic) NOEXCEPT;
+
+    /// Zero threads implies hardware concurrency, window is the maximum
+    /// number of blocks held in the reorder buffer (minimum one).
+    block_file(size_t threads, size_t window) NOEXCEPT;
+
+    /// Import all framed blocks of the file, false if stopped by handler.
+    /// The file must remain valid for the duration of the call.
+    bool import(const data_slice& file, uint32_t magic,
+        const handler& handler) NOEXCEPT;
+
+    /// Counters, may be read from any thread during import.
+    /// -----------------------------------------------------------------------
+
+    /// Emitted blocks and their framed bytes.
+    size_t blocks() const NOEXCEPT;
+    size_t bytes() const NOEXCEPT;
+
+    /// Emitted bytes per second since the start of the last import.
+    size_t throughput() const NOEXCEPT;
+
+    /// Current and peak number of blocks awaiting emission.
+    size_t depth() const NOEXCEPT;
+    size_t peak_depth() const NOEXCEPT;
+
+private:
+    using clock = std::chrono::steady_clock;
+
+    const size_t threads_;
+    const size_t window_;
+    std::atomic<size_t> blocks_{};
+    std::atomic<size_t> bytes_{};
+    std::atomic<size_t> depth_{};
+    std::atomic<size_t> peak_depth_{};
+    std::atomic<clock::rep> start_{};
+};
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,137 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_CHAIN_BLOCK_PARSER_HPP
+#define LIBBITCOIN_SYSTEM_CHAIN_BLOCK_PARSER_HPP
+
+#include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/chain/header.hpp>
+#include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/chain/wire_scanner.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+/// Push-style resumable deserializer of a wire (witness) serialized block.
+/// Fragments of any size are pushed as they arrive. The header and each
+/// transaction are constructed and hashed as soon as their bytes complete,
+/// so only the bytes of the object in progress are retained (not the full
+/// message). Not thread safe.
+class BC_API block_parser
+{
+public:
+    DELETE_COPY_MOVE_DESTRUCT(block_parser);
+
+    enum class result
+    {
+        incomplete,
+        complete,
+        invalid
+    };
+
+    block_parser() NOEXCEPT;
+
+    /// Consume a fragment. Bytes beyond the end of the block are invalid.
+    /// Once complete or invalid, further pushes return the same result.
+    result push(const data_slice& fragment) NOEXCEPT;
+
+    /// Discard all state, in order to parse another block.
+    void reset() NOEXCEPT;
+
+    /// Current result.
+    result state() const NOEXCEPT;
+
+    /// Hashed header, nullptr until its bytes are complete.
+    const header::cptr& header_ptr() const NOEXCEPT;
+
+    /// Hashed transactions completed so far.
+    const transaction_cptrs& transactions() const NOEXCEPT;
+
+    /// Transaction boundaries within the block, completed so far.
+    const wire_scanner::bounds_list& bounds() const NOEXCEPT;
+
+    /// The block, nullptr until complete.
+    const block::cptr& block_ptr() const NOEXCEPT;
+
+private:
+    enum class phase
+    {
+        header,
+        count,
+        transactions
+    };
+
+    enum class step
+    {
+        version,
+        inputs,
+        flag,
+        witness_inputs,
+        input,
+        input_script,
+        sequence,
+        outputs,
+        output,
+        output_script,
+        witnesses,
+        element,
+        locktime
+    };
+
+    bool available(size_t size) const NOEXCEPT;
+    bool skip(size_t size) NOEXCEPT;
+    bool read_size(size_t& out, size_t limit) NOEXCEPT;
+    bool skip_sized(size_t limit) NOEXCEPT;
+    bool parse_next() NOEXCEPT;
+    bool parse_transaction() NOEXCEPT;
+    bool complete_transaction() NOEXCEPT;
+
+    // Bytes of the object in progress (and any that follow it).
+    data_chunk buffer_;
+    size_t start_;
+    size_t position_;
+    size_t offset_;
+    result result_;
+    phase phase_;
+
+    // Transaction cursor.
+    step step_;
+    size_t inputs_;
+    size_t outputs_;
+    size_t elements_;
+    size_t index_;
+    size_t element_;
+    size_t witness_start_;
+    bool segregated_;
+
+    // Results.
+    size_t count_;
+    header::cptr header_;
+    chain::transactions_ptr txs_;
+    wire_scanner::bounds_list bounds_;
+    block::cptr block_;
+};
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
+
+#endif
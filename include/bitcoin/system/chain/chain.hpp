@@ -21,6 +21,8 @@
 
 #include <bitcoin/system/chain/annex.hpp>
 #include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/chain/block_file.hpp>
+#include <bitcoin/system/chain/block_parser.hpp>
 #include <bitcoin/system/chain/chain.hpp>
 #include <bitcoin/system/chain/chain_state.hpp>
 #include <bitcoin/system/chain/checkpoint.hpp>
@@ -48,6 +50,7 @@
 #include <bitcoin/system/chain/taproot.hpp>
 #include <bitcoin/system/chain/tapscript.hpp>
 #include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/chain/wire_scanner.hpp>
 #include <bitcoin/system/chain/witness.hpp>
 
 // Byte copy cost is computed as ceilinged divide of total member bits by 8 (128 bits per shared_ptr).
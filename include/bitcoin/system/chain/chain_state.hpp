@@ -19,11 +19,11 @@
 #ifndef LIBBITCOIN_SYSTEM_CHAIN_CHAIN_STATE_HPP
 #define LIBBITCOIN_SYSTEM_CHAIN_CHAIN_STATE_HPP
 
-#include <deque>
 #include <memory>
 #include <bitcoin/system/chain/checkpoint.hpp>
 #include <bitcoin/system/chain/context.hpp>
 #include <bitcoin/system/chain/enums/flags.hpp>
+#include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/forks.hpp>
 #include <bitcoin/system/hash/hash.hpp>
@@ -46,9 +46,9 @@ class BC_API chain_state
 public:
     DELETE_COPY_MOVE_DESTRUCT(chain_state);
 
-    typedef std::deque<uint32_t> bitss;
-    typedef std::deque<uint32_t> versions;
-    typedef std::deque<uint32_t> timestamps;
+    typedef ring_buffer<uint32_t> bitss;
+    typedef ring_buffer<uint32_t> versions;
+    typedef ring_buffer<uint32_t> timestamps;
     typedef std::shared_ptr<const chain_state> cptr;
     typedef struct { size_t count; size_t high; } range;
 
@@ -109,7 +109,7 @@ public:
         hash_digest bip9_bit2_hash{};
 
         /// Sum of all work from genesis to block height.
-        uint256_t cumulative_work{};
+        uint256 cumulative_work{};
 
         /// Values must be ordered by height with high (block - 1) last.
         struct
@@ -159,6 +159,18 @@ public:
     static map get_map(size_t height,
         const system::settings& settings) NOEXCEPT;
 
+    /// Reserve history windows of values for rolling across the given map.
+    /// Reserved windows are promoted in place without reallocation.
+    static void reserve(data& values, const map& map) NOEXCEPT;
+
+    /// Promote parent header values in place to the given (child) header.
+    /// This is the rolling equivalent of chain_state(parent, header, settings)
+    /// but does not copy history windows, for sequential (e.g. startup)
+    /// construction of header states. Use chain_state(std::move(values),
+    /// settings) to obtain the state (e.g. top) for the rolled values.
+    static void roll(data& values, const chain::header& header,
+        const system::settings& settings) NOEXCEPT;
+
     /// The block version to signal based on configured forks.
     static uint32_t signal_version(
         const system::settings& settings) NOEXCEPT;
@@ -182,6 +194,7 @@ public:
     chain::context context() const NOEXCEPT;
     const hash_digest& hash() const NOEXCEPT;
     const uint256_t& cumulative_work() const NOEXCEPT;
+    const uint256& fixed_cumulative_work() const NOEXCEPT;
     uint32_t minimum_block_version() const NOEXCEPT;
     uint32_t work_required() const NOEXCEPT;
     uint32_t timestamp() const NOEXCEPT;
@@ -229,6 +242,11 @@ private:
     static size_t bip9_bit2_height(size_t height,
         const checkpoint& bip9_bit2_active_checkpoint) NOEXCEPT;
 
+    static void promote(data& values, const forks& forks,
+        const system::settings& settings) NOEXCEPT;
+    static void assign(data& values, const header& header,
+        const system::settings& settings) NOEXCEPT;
+
     static data to_pool(const chain_state& top,
         const system::settings& settings) NOEXCEPT;
     static data to_block(const chain_state& pool, const block& block,
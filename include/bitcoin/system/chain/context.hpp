@@ -25,6 +25,9 @@
 
 namespace libbitcoin {
 namespace system {
+
+namespace machine { class profiler; }
+
 namespace chain {
 
 class BC_API context final
@@ -56,6 +59,12 @@ public:
         return bits != work_required;
     }
 
+    /// Script execution (connect) is bypassed for an assumed valid block.
+    inline bool is_assumed_valid() const NOEXCEPT
+    {
+        return assume_valid;
+    }
+
     /// Header context within chain.
     uint32_t flags;
     uint32_t timestamp;
@@ -63,6 +72,16 @@ public:
     size_t height;
     uint32_t minimum_block_version;
     uint32_t work_required;
+
+    /// Set by caller for ancestors of an assumed valid block (milestone).
+    /// This affects only connect, check/accept/confirm are unaffected.
+    bool assume_valid{ false };
+
+    /// Set by caller to profile script execution (ignored unless the library
+    /// is built with profiling). The member is declared in all builds so the
+    /// class layout does not depend on the build configuration.
+    /// This is not context, so it is excluded from equality comparison.
+    machine::profiler* profile{ nullptr };
 };
 
 bool operator==(const context& left, const context& right) NOEXCEPT;
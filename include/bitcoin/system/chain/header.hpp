@@ -20,7 +20,6 @@
 #define LIBBITCOIN_SYSTEM_CHAIN_HEADER_HPP
 
 #include <memory>
-#include <optional>
 #include <bitcoin/system/chain/chain_state.hpp>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
@@ -40,6 +39,7 @@ public:
     typedef std::shared_ptr<const header> cptr;
 
     static uint256_t proof(uint32_t bits) NOEXCEPT;
+    static uint256 fixed_proof(uint32_t bits) NOEXCEPT;
     static constexpr size_t serialized_size() NOEXCEPT
     {
         return sizeof(version_)
@@ -69,6 +69,8 @@ public:
     header(std::istream& stream) NOEXCEPT;
     header(reader&& source) NOEXCEPT;
     header(reader& source) NOEXCEPT;
+    header(slice_reader&& source) NOEXCEPT;
+    header(slice_reader& source) NOEXCEPT;
 
     /// Operators.
     /// -----------------------------------------------------------------------
@@ -82,6 +84,7 @@ public:
     data_chunk to_data() const NOEXCEPT;
     void to_data(std::ostream& stream) const NOEXCEPT;
     void to_data(writer& sink) const NOEXCEPT;
+    void to_data(slab_writer& sink) const NOEXCEPT;
 
 
     /// Properties.
@@ -97,16 +100,17 @@ public:
 
     /// Computed properties.
     uint256_t proof() const NOEXCEPT;
+    uint256 fixed_proof() const NOEXCEPT;
     hash_digest hash() const NOEXCEPT;
 
     /// Cache and metadata.
     /// -----------------------------------------------------------------------
-    /// getters/setters, const/mutable, not thread safe.
+    /// getters/setters, const/mutable, setters not thread safe.
 
-    /// Set to avoid hash() re-computation.
+    /// Set to avoid hash() re-computation, call before header is shared.
     void set_hash(const hash_digest& hash) const NOEXCEPT;
 
-    /// Reference used to avoid copy, sets cache if not set.
+    /// Reference used to avoid copy, sets cache if not set (thread safe).
     const hash_digest& get_hash() const NOEXCEPT;
 
     /// Set/get chain_state associated with the header, may be nullptr.
@@ -144,7 +148,10 @@ protected:
     // error::incorrect_proof_of_work
 
 private:
+    template <typename Sink>
+    void serialize(Sink& sink) const NOEXCEPT;
     void assign_data(reader& source) NOEXCEPT;
+    void assign_data(slice_reader& source) NOEXCEPT;
 
     // Header should be stored as shared (adds 16 bytes).
     // copy: 4 * 32 + 2 * 256 + 1 = 81 bytes (vs. 16 when shared).
@@ -157,7 +164,7 @@ private:
     bool valid_;
 
     // Identity hash caching.
-    mutable std::optional<hash_digest> hash_{};
+    mutable once_cache<hash_digest> hash_{};
 
     // Chain state caching.
     mutable chain_state::cptr state_{};
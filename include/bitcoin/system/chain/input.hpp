@@ -66,12 +66,15 @@ public:
     input(const chain::point::cptr& point, const chain::script::cptr& script,
         const chain::witness::cptr& witness, uint32_t sequence) NOEXCEPT;
 
+    input(const data_chunk& data) NOEXCEPT;
     input(stream::in::fast&& stream) NOEXCEPT;
     input(stream::in::fast& stream) NOEXCEPT;
     input(std::istream&& stream) NOEXCEPT;
     input(std::istream& stream) NOEXCEPT;
     input(reader&& source) NOEXCEPT;
     input(reader& source) NOEXCEPT;
+    input(slice_reader&& source) NOEXCEPT;
+    input(slice_reader& source) NOEXCEPT;
 
     /// Operators.
     /// -----------------------------------------------------------------------
@@ -85,6 +88,8 @@ public:
     data_chunk to_data() const NOEXCEPT;
     void to_data(std::ostream& stream) const NOEXCEPT;
     void to_data(writer& sink) const NOEXCEPT;
+    void to_data(slab_writer& sink) const NOEXCEPT;
+    void to_data(tee_writer& sink) const NOEXCEPT;
 
     /// Properties.
     /// -----------------------------------------------------------------------
@@ -123,6 +128,9 @@ protected:
         bool valid) NOEXCEPT;
 
 private:
+    template <typename Sink>
+    void serialize(Sink& sink) const NOEXCEPT;
+
     typedef struct { size_t nominal; size_t witnessed; } sizes;
 
     static sizes serialized_size(const chain::script& script) NOEXCEPT;
@@ -135,7 +143,8 @@ private:
     friend class transaction;
     size_t nominal_size() const NOEXCEPT;
     size_t witnessed_size() const NOEXCEPT;
-    void set_witness(reader& source) NOEXCEPT;
+    template <typename Source>
+    void set_witness(Source& source) NOEXCEPT;
 
     const chain::witness& get_witness() const NOEXCEPT;
     const chain::witness::cptr& get_witness_cptr() const NOEXCEPT;
@@ -111,6 +111,8 @@ public:
     operation(std::istream& stream) NOEXCEPT;
     operation(reader&& source) NOEXCEPT;
     operation(reader& source) NOEXCEPT;
+    operation(slice_reader&& source) NOEXCEPT;
+    operation(slice_reader& source) NOEXCEPT;
 
     // TODO: move to config serialization wrapper.
     // TODO: a byte-deserialized operation cannot be invalid unless empty.
@@ -132,6 +134,8 @@ public:
     data_chunk to_data() const NOEXCEPT;
     void to_data(std::ostream& stream) const NOEXCEPT;
     void to_data(writer& sink) const NOEXCEPT;
+    void to_data(slab_writer& sink) const NOEXCEPT;
+    void to_data(tee_writer& sink) const NOEXCEPT;
 
     // TODO: move to config serialization wrapper.
     std::string to_string(uint32_t active_flags) const NOEXCEPT;
@@ -155,7 +159,8 @@ protected:
 private:
     // So script may call count_op.
     friend class script;
-    static bool count_op(reader& source) NOEXCEPT;
+    template <typename Source>
+    static bool count_op(Source& source) NOEXCEPT;
 
     static operation from_push_data(const chunk_cptr& data,
         bool minimal) NOEXCEPT;
@@ -166,7 +171,8 @@ private:
     static const data_chunk& no_data() NOEXCEPT;
     static const chunk_cptr& no_data_cptr() NOEXCEPT;
     static const chunk_cptr& any_data_cptr() NOEXCEPT;
-    static uint32_t read_data_size(opcode code, reader& source) NOEXCEPT;
+    template <typename Source>
+    static uint32_t read_data_size(opcode code, Source& source) NOEXCEPT;
     static inline opcode opcode_from_data(const data_chunk& push_data,
         bool minimal) NOEXCEPT
     {
@@ -178,7 +184,10 @@ private:
     size_t data_size() const NOEXCEPT;
     const data_chunk& get_data() const NOEXCEPT;
     const chunk_cptr& get_data_cptr() const NOEXCEPT;
-    void assign_data(reader& source) NOEXCEPT;
+    template <typename Sink>
+    void serialize(Sink& sink) const NOEXCEPT;
+    template <typename Source>
+    void assign_data(Source& source) NOEXCEPT;
 
     // Operation should not be stored as shared (adds 16 bytes).
     // copy: 8 + 2 * 64 + 1 = 18 bytes (vs. 16 when shared).
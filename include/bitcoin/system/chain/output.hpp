@@ -21,6 +21,7 @@
 
 #include <memory>
 #include <bitcoin/system/chain/script.hpp>
+#include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/hash/hash.hpp>
 #include <bitcoin/system/stream/stream.hpp>
@@ -49,12 +50,15 @@ public:
     output(uint64_t value, const chain::script& script) NOEXCEPT;
     output(uint64_t value, const chain::script::cptr& script) NOEXCEPT;
 
+    output(const data_chunk& data) NOEXCEPT;
     output(stream::in::fast&& stream) NOEXCEPT;
     output(stream::in::fast& stream) NOEXCEPT;
     output(std::istream&& stream) NOEXCEPT;
     output(std::istream& stream) NOEXCEPT;
     output(reader&& source) NOEXCEPT;
     output(reader& source) NOEXCEPT;
+    output(slice_reader&& source) NOEXCEPT;
+    output(slice_reader& source) NOEXCEPT;
 
     /// Operators.
     /// -----------------------------------------------------------------------
@@ -68,6 +72,8 @@ public:
     data_chunk to_data() const NOEXCEPT;
     void to_data(std::ostream& stream) const NOEXCEPT;
     void to_data(writer& sink) const NOEXCEPT;
+    void to_data(slab_writer& sink) const NOEXCEPT;
+    void to_data(tee_writer& sink) const NOEXCEPT;
 
     /// Properties.
     /// -----------------------------------------------------------------------
@@ -89,7 +95,7 @@ public:
     size_t signature_operations(bool bip141) const NOEXCEPT;
     bool is_dust(uint64_t minimum_output_value) const NOEXCEPT;
 
-    /// Cache setters/getters, not thread safe.
+    /// Cache getters, thread safe.
     /// -----------------------------------------------------------------------
 
     const hash_digest& get_hash() const NOEXCEPT;
@@ -99,6 +105,8 @@ protected:
         bool valid) NOEXCEPT;
 
 private:
+    template <typename Sink>
+    void serialize(Sink& sink) const NOEXCEPT;
     void assign_data(reader& source) NOEXCEPT;
     static size_t serialized_size(const chain::script& script,
         uint64_t value) NOEXCEPT;
@@ -113,7 +121,7 @@ private:
     size_t size_;
 
     // Signature hash caching (tapscript hash_single).
-    mutable std::shared_ptr<const hash_digest> cache_{};
+    mutable once_cache<std::shared_ptr<const hash_digest>> cache_{};
 };
 
 typedef std_vector<output> outputs;
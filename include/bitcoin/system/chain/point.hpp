@@ -55,12 +55,15 @@ public:
     point(hash_digest&& hash, uint32_t index) NOEXCEPT;
     point(const hash_digest& hash, uint32_t index) NOEXCEPT;
 
+    point(const data_chunk& data) NOEXCEPT;
     point(stream::in::fast&& stream) NOEXCEPT;
     point(stream::in::fast& stream) NOEXCEPT;
     point(std::istream&& stream) NOEXCEPT;
     point(std::istream& stream) NOEXCEPT;
     point(reader&& source) NOEXCEPT;
     point(reader& source) NOEXCEPT;
+    point(slice_reader&& source) NOEXCEPT;
+    point(slice_reader& source) NOEXCEPT;
 
     /// Operators.
     /// -----------------------------------------------------------------------
@@ -74,6 +77,8 @@ public:
     data_chunk to_data() const NOEXCEPT;
     void to_data(std::ostream& stream) const NOEXCEPT;
     void to_data(writer& sink) const NOEXCEPT;
+    void to_data(slab_writer& sink) const NOEXCEPT;
+    void to_data(tee_writer& sink) const NOEXCEPT;
 
     /// Properties.
     /// -----------------------------------------------------------------------
@@ -91,7 +96,10 @@ protected:
     point(const hash_digest& hash, uint32_t index, bool valid) NOEXCEPT;
 
 private:
+    template <typename Sink>
+    void serialize(Sink& sink) const NOEXCEPT;
     void assign_data(reader& source) NOEXCEPT;
+    void assign_data(slice_reader& source) NOEXCEPT;
 
     // The index is consensus-serialized as a fixed 4 bytes, however it is
     // effectively bound to 2^17 by the block byte size limit.
@@ -108,6 +108,8 @@ public:
     script(std::istream& stream, bool prefix) NOEXCEPT;
     script(reader&& source, bool prefix) NOEXCEPT;
     script(reader& source, bool prefix) NOEXCEPT;
+    script(slice_reader&& source, bool prefix) NOEXCEPT;
+    script(slice_reader& source, bool prefix) NOEXCEPT;
 
     // TODO: move to config serialization wrapper.
     script(const std::string& mnemonic) NOEXCEPT;
@@ -128,6 +130,8 @@ public:
     data_chunk to_data(bool prefix) const NOEXCEPT;
     void to_data(std::ostream& stream, bool prefix) const NOEXCEPT;
     void to_data(writer& sink, bool prefix) const NOEXCEPT;
+    void to_data(slab_writer& sink, bool prefix) const NOEXCEPT;
+    void to_data(tee_writer& sink, bool prefix) const NOEXCEPT;
 
     // TODO: move to config serialization wrapper.
     std::string to_string(uint32_t active_flags) const NOEXCEPT;
@@ -175,9 +179,13 @@ private:
     static script from_operations(operations&& ops) NOEXCEPT;
     static script from_operations(const operations& ops) NOEXCEPT;
     static script from_string(const std::string& mnemonic) NOEXCEPT;
-    static size_t op_count(reader& source) NOEXCEPT;
+    template <typename Source>
+    static size_t op_count(Source& source) NOEXCEPT;
     static size_t serialized_size(const operations& ops) NOEXCEPT;
-    void assign_data(reader& source, bool prefix) NOEXCEPT;
+    template <typename Sink>
+    void serialize(Sink& sink, bool prefix) const NOEXCEPT;
+    template <typename Source>
+    void assign_data(Source& source, bool prefix) NOEXCEPT;
 
     // Script should be stored as shared.
     operations ops_;
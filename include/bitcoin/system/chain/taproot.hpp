@@ -33,12 +33,32 @@ namespace chain {
 class BC_API taproot
 {
 public:
+    /// Script-path spend commitment, for batched verification.
+    struct commitment
+    {
+        tapscript control;
+        ec_xonly out_key;
+        script::cptr leaf_script;
+        hash_digest leaf;
+        bool valid;
+    };
+
+    typedef std_vector<commitment> commitments;
+
+    /// Verified commitment of each input (nullptr if none), for connect.
+    typedef std_vector<const commitment*> commitment_ptrs;
+
     static hash_digest leaf_hash(uint8_t version,
         const script& script) NOEXCEPT;
     static bool drop_annex(chunk_cptrs& stack) NOEXCEPT;
     static bool verify_commit(const tapscript& control,
         const ec_xonly& out_key, const hash_digest& leaf) NOEXCEPT;
 
+    /// Set commitment.valid as verify_commit, for each of the batch.
+    /// Branch and tweak hashes are vectorized across the batch (by path
+    /// level), and tweaked keys are checked concurrently.
+    static void verify_commits(commitments& batch) NOEXCEPT;
+
 protected:
     static hash_digest merkle_root(const tapscript::keys_t& keys,
         size_t count, const hash_digest& tapleaf_hash) NOEXCEPT;
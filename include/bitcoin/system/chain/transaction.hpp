@@ -20,12 +20,13 @@
 #define LIBBITCOIN_SYSTEM_CHAIN_TRANSACTION_HPP
 
 #include <memory>
-#include <optional>
 #include <bitcoin/system/chain/enums/coverage.hpp>
 #include <bitcoin/system/chain/context.hpp>
 #include <bitcoin/system/chain/input.hpp>
 #include <bitcoin/system/chain/output.hpp>
 #include <bitcoin/system/chain/point.hpp>
+#include <bitcoin/system/chain/taproot.hpp>
+#include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/error/error.hpp>
 #include <bitcoin/system/hash/hash.hpp>
@@ -70,12 +71,15 @@ public:
     transaction(uint32_t version, const inputs_cptr& inputs,
         const outputs_cptr& outputs, uint32_t locktime) NOEXCEPT;
 
+    transaction(const data_chunk& data, bool witness) NOEXCEPT;
     transaction(stream::in::fast&& stream, bool witness) NOEXCEPT;
     transaction(stream::in::fast& stream, bool witness) NOEXCEPT;
     transaction(std::istream&& stream, bool witness) NOEXCEPT;
     transaction(std::istream& stream, bool witness) NOEXCEPT;
     transaction(reader&& source, bool witness) NOEXCEPT;
     transaction(reader& source, bool witness) NOEXCEPT;
+    transaction(slice_reader&& source, bool witness) NOEXCEPT;
+    transaction(slice_reader& source, bool witness) NOEXCEPT;
 
     /// Operators.
     /// -----------------------------------------------------------------------
@@ -89,6 +93,12 @@ public:
     data_chunk to_data(bool witness) const NOEXCEPT;
     void to_data(std::ostream& stream, bool witness) const NOEXCEPT;
     void to_data(writer& sink, bool witness) const NOEXCEPT;
+    void to_data(slab_writer& sink, bool witness) const NOEXCEPT;
+    void to_data(tee_writer& sink, bool witness) const NOEXCEPT;
+
+    /// Serialize and cache the identity hash(es) in one pass.
+    /// Caches are populated only if unset (thread safe).
+    data_chunk to_hashed_data(bool witness) const NOEXCEPT;
 
     /// Properties.
     /// -----------------------------------------------------------------------
@@ -113,7 +123,8 @@ public:
     hash_digest hash(bool witness) const NOEXCEPT;
     size_t serialized_size(bool witness) const NOEXCEPT;
 
-    /// Cache setters/getters, not thread safe.
+    /// Cache setters (not thread safe) and getters (thread safe).
+    /// Setters are for construction-time parsers, before the tx is shared.
     /// -----------------------------------------------------------------------
 
     /// Initialize with externally-produced nominal hash value, as from store.
@@ -172,6 +183,11 @@ public:
     code connect(const context& ctx) const NOEXCEPT;
     code confirm(const context& ctx) const NOEXCEPT;
 
+    /// Connect given the block batch verified script-path commitment of
+    /// each input (nullptr if none), or empty if none verified [bip341].
+    code connect(const context& ctx,
+        const taproot::commitment_ptrs& verified) const NOEXCEPT;
+
 protected:
     transaction(uint32_t version, const inputs_cptr& inputs,
         const outputs_cptr& outputs, uint32_t locktime, bool segregated,
@@ -255,12 +271,15 @@ private:
         const output_cptrs& outputs, bool segregated) NOEXCEPT;
 
     input_iterator input_at(uint32_t index) const NOEXCEPT;
-    void assign_data(reader& source, bool witness) NOEXCEPT;
+    template <typename Sink>
+    void serialize(Sink& sink, bool witness) const NOEXCEPT;
+    template <typename Source>
+    void assign_data(Source& source, bool witness) NOEXCEPT;
     chain::points points() const NOEXCEPT;
 
     // delegated
-    code connect_input(const context& ctx,
-        const input_iterator& it) const NOEXCEPT;
+    code connect_input(const context& ctx, const input_iterator& it,
+        const taproot::commitment* verified) const NOEXCEPT;
 
     // Patterns.
     // ------------------------------------------------------------------------
@@ -271,25 +290,26 @@ private:
     // Caching.
     // ------------------------------------------------------------------------
 
-    // Uncached generators.
-    void set_x1_base_hash() const NOEXCEPT;
-    void set_x2_base_hash() const NOEXCEPT;
-    void set_v1_only_hash() const NOEXCEPT;
+    // Set caches if not set (thread safe).
+    const base_cache& x1_base_hash() const NOEXCEPT;
+    const base_cache& x2_base_hash() const NOEXCEPT;
+    const only_cache& v1_only_hash() const NOEXCEPT;
 
+    // Uncached generators.
     hash_digest x1_base_hash_points() const NOEXCEPT;
     hash_digest x1_base_hash_sequences() const NOEXCEPT;
     hash_digest x1_base_hash_outputs() const NOEXCEPT;
     hash_digest v1_only_hash_amounts() const NOEXCEPT;
     hash_digest v1_only_hash_scripts() const NOEXCEPT;
 
-    // Set sha256 cache if not set, so not thread safe unless cached.
+    // Set sha256 cache if not set (thread safe).
     const hash_digest& single_hash_points() const NOEXCEPT;
     const hash_digest& single_hash_amounts() const NOEXCEPT;
     const hash_digest& single_hash_scripts() const NOEXCEPT;
     const hash_digest& single_hash_sequences() const NOEXCEPT;
     const hash_digest& single_hash_outputs() const NOEXCEPT;
 
-    // Set sha256x2 cache if not set, so not thread safe unless cached.
+    // Set sha256x2 cache if not set (thread safe).
     const hash_digest& double_hash_points() const NOEXCEPT;
     const hash_digest& double_hash_sequences() const NOEXCEPT;
     const hash_digest& double_hash_outputs() const NOEXCEPT;
@@ -335,13 +355,13 @@ private:
     sizes size_;
 
     // Identity hash caching (witness if witnessed).
-    mutable std::optional<hash_digest> nominal_hash_{};
-    mutable std::optional<hash_digest> witness_hash_{};
+    mutable once_cache<hash_digest> nominal_hash_{};
+    mutable once_cache<hash_digest> witness_hash_{};
 
     // Signature hash caching (witness and taproot).
-    mutable std::shared_ptr<base_cache> x1_base_cache_{};
-    mutable std::shared_ptr<base_cache> x2_base_cache_{};
-    mutable std::shared_ptr<only_cache> v1_only_cache_{};
+    mutable once_cache<std::shared_ptr<const base_cache>> x1_base_cache_{};
+    mutable once_cache<std::shared_ptr<const base_cache>> x2_base_cache_{};
+    mutable once_cache<std::shared_ptr<const only_cache>> v1_only_cache_{};
 };
 
 typedef std_vector<transaction> transactions;
@@ -0,0 +1,78 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_CHAIN_WIRE_SCANNER_HPP
+#define LIBBITCOIN_SYSTEM_CHAIN_WIRE_SCANNER_HPP
+
+#include <vector>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+/// Structural walk of wire (witness) serialized transactions and blocks.
+/// Varints, counts, script and witness lengths are followed in place, without
+/// constructing chain objects, to obtain the bounds of each transaction.
+/// Transaction hashes are then computed directly from the wire bytes.
+class BC_API wire_scanner
+{
+public:
+    /// Bounds of a transaction within the scanned bytes.
+    struct bounds
+    {
+        /// Byte offset of the transaction (its witness marker, if segregated,
+        /// immediately follows the four byte version).
+        size_t offset;
+
+        /// Serialized size without witness (txid preimage size).
+        size_t nominal;
+
+        /// Serialized size with witness (wire size, wtxid preimage size).
+        size_t witnessed;
+
+        /// True if serialized with marker, flag and witnesses [bip144].
+        bool segregated;
+    };
+
+    typedef std::vector<bounds> bounds_list;
+
+    /// Bounds of the transaction at the start of data, false if malformed.
+    static bool scan_transaction(bounds& out, const data_slice& data) NOEXCEPT;
+
+    /// Bounds of each transaction of a block, false if malformed or if data
+    /// is not fully consumed.
+    static bool scan_block(bounds_list& out, const data_slice& data) NOEXCEPT;
+
+    /// Transaction identifiers, computed concurrently (txid).
+    static hashes nominal_hashes(const data_slice& data,
+        const bounds_list& bounds) NOEXCEPT;
+
+    /// Witness transaction identifiers, computed concurrently (wtxid). If
+    /// coinbase, the first (coinbase) hash is null_hash [bip141].
+    static hashes witness_hashes(const data_slice& data,
+        const bounds_list& bounds, bool coinbase=true) NOEXCEPT;
+};
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
+
+#endif
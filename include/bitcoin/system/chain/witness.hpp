@@ -23,6 +23,7 @@
 #include <bitcoin/system/chain/annex.hpp>
 #include <bitcoin/system/chain/operation.hpp>
 #include <bitcoin/system/chain/script.hpp>
+#include <bitcoin/system/chain/taproot.hpp>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/hash/hash.hpp>
@@ -61,6 +62,8 @@ public:
     witness(std::istream& stream, bool prefix) NOEXCEPT;
     witness(reader&& source, bool prefix) NOEXCEPT;
     witness(reader& source, bool prefix) NOEXCEPT;
+    witness(slice_reader&& source, bool prefix) NOEXCEPT;
+    witness(slice_reader& source, bool prefix) NOEXCEPT;
 
     // TODO: move to config serialization wrapper.
     witness(const std::string& mnemonic) NOEXCEPT;
@@ -76,10 +79,13 @@ public:
 
     /// Skip a witness (as if deserialized).
     static void skip(reader& source, bool prefix) NOEXCEPT;
+    static void skip(slice_reader& source, bool prefix) NOEXCEPT;
 
     data_chunk to_data(bool prefix) const NOEXCEPT;
     void to_data(std::ostream& stream, bool prefix) const NOEXCEPT;
     void to_data(writer& sink, bool prefix) const NOEXCEPT;
+    void to_data(slab_writer& sink, bool prefix) const NOEXCEPT;
+    void to_data(tee_writer& sink, bool prefix) const NOEXCEPT;
 
     // TODO: move to config serialization wrapper.
     std::string to_string() const NOEXCEPT;
@@ -116,8 +122,16 @@ public:
     /// Script for witness validation.
     code extract_segwit(script::cptr& out_script, chunk_cptrs_ptr& out_stack,
         const script& program_script) const NOEXCEPT;
+
+    /// A verified commitment (from extract_commitment of this witness) for
+    /// the program key bypasses reverification of the script-path commitment.
     code extract_taproot(hash_cptr& out_leaf, script::cptr& out_script,
-        chunk_cptrs_ptr& out_stack, const script& program_script) const NOEXCEPT;
+        chunk_cptrs_ptr& out_stack, const script& program_script,
+        const taproot::commitment* verified=nullptr) const NOEXCEPT;
+
+    /// Script-path spend commitment (unverified), false if not tapscript.
+    bool extract_commitment(taproot::commitments& out_batch,
+        const script& program_script) const NOEXCEPT;
 
 protected:
     witness(chunk_cptrs&& stack, bool valid) NOEXCEPT;
@@ -127,7 +141,12 @@ protected:
 private:
     // TODO: move to config serialization wrapper.
     static witness from_string(const std::string& mnemonic) NOEXCEPT;
-    void assign_data(reader& source, bool prefix) NOEXCEPT;
+    template <typename Sink>
+    void serialize(Sink& sink, bool prefix) const NOEXCEPT;
+    template <typename Source>
+    static void skip_data(Source& source, bool prefix) NOEXCEPT;
+    template <typename Source>
+    void assign_data(Source& source, bool prefix) NOEXCEPT;
 
     // Witness should be stored as shared.
     chunk_cptrs stack_;
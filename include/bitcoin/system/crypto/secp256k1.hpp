@@ -87,6 +87,14 @@ struct BC_API recoverable_signature
     uint8_t recovery_id;
 };
 
+/// Parsed public key cache statistics (signature verification).
+struct BC_API key_cache_statistics
+{
+    uint64_t hits;
+    uint64_t misses;
+    size_t size;
+};
+
 /// Add EC values
 /// ---------------------------------------------------------------------------
 
@@ -200,9 +208,13 @@ BC_API bool sign(ec_signature& out, const ec_secret& secret,
     const hash_digest& hash) NOEXCEPT;
 
 /// Verify an ECDSA signature using a potential point.
+/// Parsed points are cached for reuse by subsequent verifications.
 BC_API bool verify_signature(const data_slice& point, const hash_digest& hash,
     const ec_signature& signature) NOEXCEPT;
 
+/// Statistics for the cache of points parsed by verify_signature.
+BC_API key_cache_statistics cache_statistics() NOEXCEPT;
+
 /// ECDSA recoverable sign/recover
 /// ---------------------------------------------------------------------------
 /// It is recommended to verify a signature after signing.
@@ -221,6 +233,11 @@ BC_API bool recover_public(ec_uncompressed& out,
     const recoverable_signature& recoverable,
     const hash_digest& hash) NOEXCEPT;
 
+/// Recover every point against which the (parsed) signature of hash verifies.
+/// A point verifies (verify_signature) if and only if it is recovered here.
+BC_API bool recover_candidates(uncompressed_list& out,
+    const ec_signature& signature, const hash_digest& hash) NOEXCEPT;
+
 } // namespace ecdsa
 
 namespace schnorr {
@@ -241,9 +258,13 @@ BC_API bool verify_signature(const data_chunk& x_point,
     const hash_digest& hash, const ec_signature& signature) NOEXCEPT;
 
 /// Verify Schnorr signature of hash by associated secret of the x-only point.
+/// Parsed x-only points are cached for reuse by subsequent verifications.
 BC_API bool verify_signature(const ec_xonly& x_point,
     const hash_digest& hash, const ec_signature& signature) NOEXCEPT;
 
+/// Statistics for the cache of x-only points parsed by verify_signature.
+BC_API key_cache_statistics cache_statistics() NOEXCEPT;
+
 /// Verify Schnorr commitment of key/parity to hash, results in x-only point.
 BC_API bool verify_commitment(const ec_xonly& internal_key,
     const hash_digest& tweak, const ec_xonly& tweaked_key,
@@ -0,0 +1,114 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_DATA_INLINE_VECTOR_HPP
+#define LIBBITCOIN_SYSTEM_DATA_INLINE_VECTOR_HPP
+
+#include <array>
+#include <iterator>
+#include <type_traits>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// Contiguous vector with inline storage for the first Inline elements.
+/// Elements move to a heap buffer only once size exceeds Inline, and that
+/// buffer doubles when full. Inline storage is not initialized, elements are
+/// constructed only as they are added. Type must be trivially copyable and
+/// destructible, so pop/erase only adjust the size and copy/move of an inline
+/// vector copies only its elements.
+template <typename Type, size_t Inline>
+class inline_vector
+{
+public:
+    static_assert(Inline > 0u, "inline capacity required");
+    static_assert(std::is_trivially_copyable_v<Type> &&
+        std::is_trivially_destructible_v<Type>, "trivial type required");
+
+    using value_type = Type;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = Type&;
+    using const_reference = const Type&;
+    using iterator = Type*;
+    using const_iterator = const Type*;
+
+    /// Construct.
+    inline inline_vector() NOEXCEPT;
+    inline explicit inline_vector(size_t size) NOEXCEPT;
+
+    /// Copy/move (a moved-from vector is empty and inline).
+    inline inline_vector(const inline_vector& other) NOEXCEPT;
+    inline inline_vector(inline_vector&& other) NOEXCEPT;
+    inline inline_vector& operator=(const inline_vector& other) NOEXCEPT;
+    inline inline_vector& operator=(inline_vector&& other) NOEXCEPT;
+
+    /// Capacity.
+    inline size_t capacity() const NOEXCEPT;
+    inline size_t size() const NOEXCEPT;
+    inline bool empty() const NOEXCEPT;
+    inline bool is_inline() const NOEXCEPT;
+
+    /// Element access (unguarded, caller must guard empty/index).
+    inline Type& operator[](size_t index) NOEXCEPT;
+    inline const Type& operator[](size_t index) const NOEXCEPT;
+    inline Type& back() NOEXCEPT;
+    inline const Type& back() const NOEXCEPT;
+    inline Type* data() NOEXCEPT;
+    inline const Type* data() const NOEXCEPT;
+
+    /// Modifiers (pop/erase are unguarded, caller must guard empty/position).
+    inline void push_back(const Type& value) NOEXCEPT;
+    inline void push_back(Type&& value) NOEXCEPT;
+    template <typename ...Args>
+    inline Type& emplace_back(Args&&... args) NOEXCEPT;
+    inline void pop_back() NOEXCEPT;
+    inline iterator erase(const_iterator position) NOEXCEPT;
+    inline void clear() NOEXCEPT;
+
+    /// Iteration.
+    inline iterator begin() NOEXCEPT;
+    inline iterator end() NOEXCEPT;
+    inline const_iterator begin() const NOEXCEPT;
+    inline const_iterator end() const NOEXCEPT;
+
+private:
+    inline void grow() NOEXCEPT;
+    inline void assign_inline(const inline_vector& other) NOEXCEPT;
+
+    // Not initialized by construction (within the anonymous union).
+    union { std::array<Type, Inline> inline_; };
+    std_vector<Type> heap_;
+    size_t size_;
+};
+
+} // namespace system
+} // namespace libbitcoin
+
+#define TEMPLATE template <typename Type, size_t Inline>
+#define CLASS inline_vector<Type, Inline>
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+#include <bitcoin/system/impl/data/inline_vector.ipp>
+BC_POP_WARNING()
+
+#undef CLASS
+#undef TEMPLATE
+
+#endif
@@ -0,0 +1,83 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_DATA_ONCE_CACHE_HPP
+#define LIBBITCOIN_SYSTEM_DATA_ONCE_CACHE_HPP
+
+#include <atomic>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// Lazily-computed value that is safe for concurrent readers.
+/// The first reader of an unset value computes it while others wait, so the
+/// value is computed once and all readers obtain a reference to the same
+/// value. set() is not synchronized with readers and is intended only for
+/// population before the owning object is shared (e.g. deserialization).
+/// Copy/move copies the value only if it is set at the time of the copy.
+template <typename Type>
+class once_cache
+{
+public:
+    /// Construct.
+    inline once_cache() NOEXCEPT;
+    inline once_cache(const once_cache& other) NOEXCEPT;
+    inline once_cache(once_cache&& other) NOEXCEPT;
+    inline once_cache& operator=(const once_cache& other) NOEXCEPT;
+    inline once_cache& operator=(once_cache&& other) NOEXCEPT;
+    inline ~once_cache() = default;
+
+    /// True if the value is set (thread safe).
+    inline operator bool() const NOEXCEPT;
+
+    /// The value (unguarded, caller must guard unset).
+    inline const Type& operator*() const NOEXCEPT;
+    inline const Type* operator->() const NOEXCEPT;
+
+    /// Set the value from factory() if unset and return it (thread safe).
+    template <typename Factory>
+    inline const Type& get(Factory&& factory) NOEXCEPT;
+
+    /// Set the value, replacing any existing value (not thread safe).
+    inline void set(const Type& value) NOEXCEPT;
+    inline void set(Type&& value) NOEXCEPT;
+
+private:
+    enum : uint8_t { unset, busy, full };
+
+    inline void assign(const once_cache& other) NOEXCEPT;
+
+    std::atomic<uint8_t> state_;
+    Type value_;
+};
+
+} // namespace system
+} // namespace libbitcoin
+
+#define TEMPLATE template <typename Type>
+#define CLASS once_cache<Type>
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+#include <bitcoin/system/impl/data/once_cache.ipp>
+BC_POP_WARNING()
+
+#undef CLASS
+#undef TEMPLATE
+
+#endif
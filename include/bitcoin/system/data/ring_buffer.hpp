@@ -0,0 +1,193 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_DATA_RING_BUFFER_HPP
+#define LIBBITCOIN_SYSTEM_DATA_RING_BUFFER_HPP
+
+#include <compare>
+#include <initializer_list>
+#include <iterator>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// Contiguous circular queue, a deque substitute for fixed-size windows.
+/// Capacity is a power of two (or zero) and doubles only when full, so a
+/// reserved window of constant size is pushed/popped without allocation.
+/// Copy preserves capacity, so a copied window can also be rolled in place.
+template <typename Type>
+class ring_buffer
+{
+public:
+    template <bool Const>
+    class iterator_type
+    {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const Type*, Type*>;
+        using reference = std::conditional_t<Const, const Type&, Type&>;
+        using container = std::conditional_t<Const, const ring_buffer,
+            ring_buffer>;
+
+        iterator_type() NOEXCEPT = default;
+        iterator_type(container* ring, size_t index) NOEXCEPT
+          : ring_(ring), index_(index)
+        {
+        }
+
+        /// Mutable to const conversion.
+        operator iterator_type<true>() const NOEXCEPT
+        {
+            return { ring_, index_ };
+        }
+
+        reference operator*() const NOEXCEPT { return (*ring_)[index_]; }
+        pointer operator->() const NOEXCEPT { return &(*ring_)[index_]; }
+        reference operator[](difference_type offset) const NOEXCEPT
+        {
+            return (*ring_)[index_ + offset];
+        }
+
+        iterator_type& operator++() NOEXCEPT { ++index_; return *this; }
+        iterator_type& operator--() NOEXCEPT { --index_; return *this; }
+        iterator_type operator++(int) NOEXCEPT
+            { auto copy{ *this }; ++index_; return copy; }
+        iterator_type operator--(int) NOEXCEPT
+            { auto copy{ *this }; --index_; return copy; }
+
+        iterator_type& operator+=(difference_type offset) NOEXCEPT
+            { index_ += offset; return *this; }
+        iterator_type& operator-=(difference_type offset) NOEXCEPT
+            { index_ -= offset; return *this; }
+        iterator_type operator+(difference_type offset) const NOEXCEPT
+            { return { ring_, index_ + offset }; }
+        iterator_type operator-(difference_type offset) const NOEXCEPT
+            { return { ring_, index_ - offset }; }
+        friend iterator_type operator+(difference_type offset,
+            const iterator_type& it) NOEXCEPT
+            { return it + offset; }
+        difference_type operator-(const iterator_type& other) const NOEXCEPT
+        {
+            return static_cast<difference_type>(index_) -
+                static_cast<difference_type>(other.index_);
+        }
+
+        bool operator==(const iterator_type& other) const NOEXCEPT
+            { return index_ == other.index_; }
+        auto operator<=>(const iterator_type& other) const NOEXCEPT
+            { return index_ <=> other.index_; }
+
+    private:
+        container* ring_{};
+        size_t index_{};
+    };
+
+    using value_type = Type;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = Type&;
+    using const_reference = const Type&;
+    using iterator = iterator_type<false>;
+    using const_iterator = iterator_type<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    DEFAULT_COPY_MOVE_DESTRUCT(ring_buffer);
+
+    /// Construct.
+    inline ring_buffer() NOEXCEPT;
+    inline explicit ring_buffer(size_t capacity) NOEXCEPT;
+    inline ring_buffer(std::initializer_list<Type> values) NOEXCEPT;
+
+    /// Capacity (rounded up to power of two, existing elements retained).
+    inline void reserve(size_t capacity) NOEXCEPT;
+
+    /// Size (new elements are appended as value, excess removed from back).
+    inline void resize(size_t size) NOEXCEPT;
+    inline void resize(size_t size, const Type& value) NOEXCEPT;
+    inline size_t capacity() const NOEXCEPT;
+    inline size_t size() const NOEXCEPT;
+    inline bool empty() const NOEXCEPT;
+    inline bool full() const NOEXCEPT;
+
+    /// Element access (unguarded, caller must guard empty/index).
+    inline Type& operator[](size_t index) NOEXCEPT;
+    inline const Type& operator[](size_t index) const NOEXCEPT;
+    inline Type& front() NOEXCEPT;
+    inline const Type& front() const NOEXCEPT;
+    inline Type& back() NOEXCEPT;
+    inline const Type& back() const NOEXCEPT;
+
+    /// Modifiers (pop is unguarded, caller must guard empty).
+    inline void push_front(const Type& value) NOEXCEPT;
+    inline void push_front(Type&& value) NOEXCEPT;
+    inline void push_back(const Type& value) NOEXCEPT;
+    inline void push_back(Type&& value) NOEXCEPT;
+    inline void pop_front() NOEXCEPT;
+    inline void pop_back() NOEXCEPT;
+    inline void clear() NOEXCEPT;
+
+    /// Insertion (linear, elements are rotated into place from the back).
+    inline iterator insert(const_iterator where, const Type& value) NOEXCEPT;
+    template <typename Iterator>
+    inline iterator insert(const_iterator where, Iterator first,
+        Iterator last) NOEXCEPT;
+
+    /// Iteration, ordered from front (oldest) to back (newest).
+    inline iterator begin() NOEXCEPT;
+    inline iterator end() NOEXCEPT;
+    inline const_iterator begin() const NOEXCEPT;
+    inline const_iterator end() const NOEXCEPT;
+    inline const_iterator cbegin() const NOEXCEPT;
+    inline const_iterator cend() const NOEXCEPT;
+    inline reverse_iterator rbegin() NOEXCEPT;
+    inline reverse_iterator rend() NOEXCEPT;
+    inline const_reverse_iterator rbegin() const NOEXCEPT;
+    inline const_reverse_iterator rend() const NOEXCEPT;
+    inline const_reverse_iterator crbegin() const NOEXCEPT;
+    inline const_reverse_iterator crend() const NOEXCEPT;
+
+    /// Element-wise equality (capacity is not compared).
+    inline bool operator==(const ring_buffer& other) const NOEXCEPT;
+
+private:
+    inline size_t position(size_t index) const NOEXCEPT;
+    inline void grow() NOEXCEPT;
+
+    std_vector<Type> buffer_;
+    size_t head_;
+    size_t size_;
+};
+
+} // namespace system
+} // namespace libbitcoin
+
+#define TEMPLATE template <typename Type>
+#define CLASS ring_buffer<Type>
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+#include <bitcoin/system/impl/data/ring_buffer.ipp>
+BC_POP_WARNING()
+
+#undef CLASS
+#undef TEMPLATE
+
+#endif
@@ -41,6 +41,7 @@ enum error_t
     success = 0,
     not_found,
     not_implemented,
+    invalid_frame,
 
     // no serialization, used for test
     error_last
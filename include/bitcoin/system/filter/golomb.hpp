@@ -41,6 +41,10 @@ public:
         uint8_t bits, const siphash_key& entropy,
         uint64_t target_false_positive_rate) NOEXCEPT;
 
+    static void construct(word_bit_writer& writer, const data_stack& items,
+        uint8_t bits, const siphash_key& entropy,
+        uint64_t target_false_positive_rate) NOEXCEPT;
+
     static data_chunk construct(const data_stack& items,
         uint8_t bits, const siphash_key& entropy,
         uint64_t target_false_positive_rate) NOEXCEPT;
@@ -49,6 +53,16 @@ public:
         uint8_t bits, const half_hash& entropy,
         uint64_t target_false_positive_rate) NOEXCEPT;
 
+    /// Encode a sorted set of range values, such as from distinct_set.
+    static void construct(word_bit_writer& writer,
+        const std::vector<uint64_t>& set, uint8_t bits) NOEXCEPT;
+
+    /// Hash items, which may repeat, to the sorted range values of their
+    /// distinct set. The set size is the result size. Items are not copied.
+    static std::vector<uint64_t> distinct_set(
+        const std::vector<data_slice>& items, const siphash_key& entropy,
+        uint64_t target_false_positive_rate) NOEXCEPT;
+
     /// Single element match
     /// -----------------------------------------------------------------------
 
@@ -57,6 +71,11 @@ public:
         const siphash_key& entropy, uint8_t bits,
         uint64_t target_false_positive_rate) NOEXCEPT;
 
+    static bool match_single(word_bit_reader& reader,
+        const data_chunk& target, uint64_t set_size,
+        const siphash_key& entropy, uint8_t bits,
+        uint64_t target_false_positive_rate) NOEXCEPT;
+
     static bool match_single(const data_chunk& compressed_set,
         const data_chunk& target, uint64_t set_size,
         const half_hash& entropy, uint8_t bits,
@@ -75,6 +94,11 @@ public:
         const siphash_key& entropy, uint8_t bits,
         uint64_t target_false_positive_rate) NOEXCEPT;
 
+    static bool match_stack(word_bit_reader& reader,
+        const data_stack& targets, uint64_t set_size,
+        const siphash_key& entropy, uint8_t bits,
+        uint64_t target_false_positive_rate) NOEXCEPT;
+
     static bool match_stack(const data_chunk& compressed_set,
         const data_stack& targets, uint64_t set_size,
         const half_hash& entropy, uint8_t bits,
@@ -86,12 +110,33 @@ public:
         uint64_t target_false_positive_rate) NOEXCEPT;
 
 private:
+    template <typename Writer>
+    static void encode_set(Writer& writer, const data_stack& items,
+        uint8_t bits, const siphash_key& entropy,
+        uint64_t target_false_positive_rate) NOEXCEPT;
+    template <typename Writer>
+    static void encode_sorted(Writer& writer,
+        const std::vector<uint64_t>& set, uint8_t bits) NOEXCEPT;
+    template <typename Reader>
+    static bool find_single(Reader& reader, const data_chunk& target,
+        uint64_t set_size, const siphash_key& entropy, uint8_t bits,
+        uint64_t target_false_positive_rate) NOEXCEPT;
+    template <typename Reader>
+    static bool find_stack(Reader& reader, const data_stack& targets,
+        uint64_t set_size, const siphash_key& entropy, uint8_t bits,
+        uint64_t target_false_positive_rate) NOEXCEPT;
+
     static void encode(bitwriter& writer, uint64_t value,
         uint8_t modulo_exponent) NOEXCEPT;
+    static void encode(word_bit_writer& writer, uint64_t value,
+        uint8_t modulo_exponent) NOEXCEPT;
     static uint64_t decode(bitreader& reader,
         uint8_t modulo_exponent) NOEXCEPT;
+    static uint64_t decode(word_bit_reader& reader,
+        uint8_t modulo_exponent) NOEXCEPT;
     static uint64_t hash_to_range(const data_slice& item,
         uint64_t bound, const siphash_key& key) NOEXCEPT;
+    static uint64_t to_range(uint64_t hash, uint64_t bound) NOEXCEPT;
     static std::vector<uint64_t> hashed_set_construct(const data_stack& items,
         uint64_t set_size, uint64_t target_false_positive_rate,
         const siphash_key& key) NOEXCEPT;
@@ -161,6 +161,13 @@ public:
     static constexpr digests_t& merkle_hash(digests_t& digests) NOEXCEPT;
     static constexpr digest_t merkle_root(digests_t&& digests) NOEXCEPT;
 
+    /// Tagged hashing of digest pairs (sha256/512).
+    /// -----------------------------------------------------------------------
+
+    /// Hash each digest pair following the one block midstate of a tag.
+    static digests_t& tagged_hash(digests_t& digests,
+        const state_t& midstate) NOEXCEPT;
+
 protected:
     /// Intrinsics constants.
     /// -----------------------------------------------------------------------
@@ -379,6 +386,17 @@ protected:
     constexpr static void merkle_hash_(digests_t& digests,
         size_t offset=zero) NOEXCEPT;
 
+    template <typename xWord>
+    INLINE static void schedule_2(xbuffer_t<xWord>& xbuffer) NOEXCEPT;
+
+    template <typename xWord, if_extended<xWord> = true>
+    INLINE static void tagged_hash_vector(idigests_t& digests,
+        iblocks_t& blocks, const state_t& midstate) NOEXCEPT;
+    INLINE static void tagged_hash_vector(digests_t& digests,
+        const state_t& midstate) NOEXCEPT;
+    static void tagged_hash_(digests_t& digests, const state_t& midstate,
+        size_t offset=zero) NOEXCEPT;
+
     /// sigma0 vectorization (single blocks).
     /// -----------------------------------------------------------------------
 
@@ -23,6 +23,7 @@
 #define LIBBITCOIN_SYSTEM_HASH_SIPHASH
 
 #include <tuple>
+#include <vector>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/endian/endian.hpp>
@@ -38,6 +39,12 @@ BC_API uint64_t siphash(const siphash_key& key,
 BC_API uint64_t siphash(const half_hash& hash,
     const data_slice& message) NOEXCEPT;
 
+/// Hash each message under the same key, interleaving groups of messages.
+BC_API void siphash(std::vector<uint64_t>& out, const siphash_key& key,
+    const data_stack& messages) NOEXCEPT;
+BC_API void siphash(std::vector<uint64_t>& out, const siphash_key& key,
+    const std::vector<data_slice>& messages) NOEXCEPT;
+
 constexpr siphash_key to_siphash_key(const half_hash& hash) NOEXCEPT
 {
     const auto part = split(hash);
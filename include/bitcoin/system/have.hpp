@@ -81,6 +81,11 @@
     #define HAVE_ARM
 #endif
 
+/// GNU/Clang 128 bit integer extension (64 bit targets only).
+#if defined(__SIZEOF_INT128__) && (defined(HAVE_CLANG) || defined(HAVE_GNUC))
+    #define HAVE_INT128
+#endif
+
 /// WITH_ build symbols.
 /// ---------------------------------------------------------------------------
 
@@ -98,6 +103,11 @@
     #endif
 #endif
 
+/// Custom option to compile script profiling hooks (see machine::profiler).
+#if defined(WITH_PROFILE)
+    #define HAVE_PROFILE
+#endif
+
 // Custom options to use extended SVE variable width.
 #if defined(__ARM_FEATURE_SVE)
     #if defined(WITH_512)
@@ -79,18 +79,14 @@ compact::from_compact(const parse& compact) NOEXCEPT
     );
 }
 
-// public
-
-constexpr compact::span_type
-compact::expand(small_type exponential) NOEXCEPT
+constexpr typename compact::parse
+compact::to_strict(small_type exponential) NOEXCEPT
 {
     auto compact = to_compact(exponential);
 
-    if (compact.negative)
-        return 0;
-
     // This is strict validation.
-    if (compact.exponent == add1(e_max) &&
+    if (!compact.negative &&
+        compact.exponent == add1(e_max) &&
         is_negated(compact.mantissa) &&
         byte_width(compact.mantissa) == sub1(m_bytes))
     {
@@ -99,10 +95,45 @@ compact::expand(small_type exponential) NOEXCEPT
     }
 
     // Above exists only because negatives were inadvertently excluded.
-    
+    return compact;
+}
+
+// public
+
+constexpr compact::span_type
+compact::expand(small_type exponential) NOEXCEPT
+{
+    const auto compact = to_strict(exponential);
+
+    if (compact.negative)
+        return 0;
+
     return base256e::expand(from_compact(compact));
 }
 
+constexpr uint256
+compact::expand_fixed(small_type exponential) NOEXCEPT
+{
+    const auto compact = to_strict(exponential);
+
+    if (compact.negative)
+        return 0;
+
+    // This is base256e::expand, with fixed-width span.
+    const auto small = from_compact(compact);
+    const auto shift = raise(shift_right(small, precision));
+    const auto mantissa = mask_left<small_type>(small, e_width);
+
+    // Zero returned if unsigned exponent is out of bounds [0..e_max].
+    if (is_limited(shift, span))
+        return 0;
+
+    const uint256 number{ mantissa };
+    return shift > precision ?
+        number << (shift - precision) :
+        number >> (precision - shift);
+}
+
 constexpr compact::small_type
 compact::compress(const span_type& number) NOEXCEPT
 {
@@ -0,0 +1,300 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_DATA_INLINE_VECTOR_IPP
+#define LIBBITCOIN_SYSTEM_DATA_INLINE_VECTOR_IPP
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+TEMPLATE
+inline CLASS::
+inline_vector() NOEXCEPT
+  : heap_{}, size_{}
+{
+}
+
+TEMPLATE
+inline CLASS::
+inline_vector(size_t size) NOEXCEPT
+  : heap_{}, size_{ size }
+{
+    if (size > Inline)
+        heap_.resize(size);
+    else
+        std::uninitialized_value_construct_n(inline_.data(), size);
+}
+
+// Copy/move.
+// ----------------------------------------------------------------------------
+// Only the elements of an inline vector are copied, not its full storage.
+
+TEMPLATE
+inline CLASS::
+inline_vector(const inline_vector& other) NOEXCEPT
+  : heap_{ other.heap_ }, size_{ other.size_ }
+{
+    assign_inline(other);
+}
+
+// The moved-from vector is reset to empty inline, so that its size cannot
+// exceed its (now inline) capacity.
+TEMPLATE
+inline CLASS::
+inline_vector(inline_vector&& other) NOEXCEPT
+  : heap_{ std::move(other.heap_) }, size_{ other.size_ }
+{
+    assign_inline(other);
+    other.heap_.clear();
+    other.size_ = zero;
+}
+
+TEMPLATE
+inline CLASS& CLASS::
+operator=(const inline_vector& other) NOEXCEPT
+{
+    if (this == &other)
+        return *this;
+
+    heap_ = other.heap_;
+    size_ = other.size_;
+    assign_inline(other);
+    return *this;
+}
+
+TEMPLATE
+inline CLASS& CLASS::
+operator=(inline_vector&& other) NOEXCEPT
+{
+    if (this == &other)
+        return *this;
+
+    heap_ = std::move(other.heap_);
+    size_ = other.size_;
+    assign_inline(other);
+    other.heap_.clear();
+    other.size_ = zero;
+    return *this;
+}
+
+// Capacity.
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+inline size_t CLASS::
+capacity() const NOEXCEPT
+{
+    return is_inline() ? Inline : heap_.size();
+}
+
+TEMPLATE
+inline size_t CLASS::
+size() const NOEXCEPT
+{
+    return size_;
+}
+
+TEMPLATE
+inline bool CLASS::
+empty() const NOEXCEPT
+{
+    return is_zero(size_);
+}
+
+// Once spilled the heap buffer is retained, even if size reduces.
+TEMPLATE
+inline bool CLASS::
+is_inline() const NOEXCEPT
+{
+    return heap_.empty();
+}
+
+// Element access.
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+inline Type& CLASS::
+operator[](size_t index) NOEXCEPT
+{
+    BC_ASSERT(index < size_);
+    return data()[index];
+}
+
+TEMPLATE
+inline const Type& CLASS::
+operator[](size_t index) const NOEXCEPT
+{
+    BC_ASSERT(index < size_);
+    return data()[index];
+}
+
+TEMPLATE
+inline Type& CLASS::
+back() NOEXCEPT
+{
+    BC_ASSERT(!empty());
+    return data()[sub1(size_)];
+}
+
+TEMPLATE
+inline const Type& CLASS::
+back() const NOEXCEPT
+{
+    BC_ASSERT(!empty());
+    return data()[sub1(size_)];
+}
+
+TEMPLATE
+inline Type* CLASS::
+data() NOEXCEPT
+{
+    return is_inline() ? inline_.data() : heap_.data();
+}
+
+TEMPLATE
+inline const Type* CLASS::
+data() const NOEXCEPT
+{
+    return is_inline() ? inline_.data() : heap_.data();
+}
+
+// Modifiers.
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+inline void CLASS::
+push_back(const Type& value) NOEXCEPT
+{
+    if (size_ == capacity())
+        grow();
+
+    std::construct_at(std::next(data(), size_++), value);
+}
+
+TEMPLATE
+inline void CLASS::
+push_back(Type&& value) NOEXCEPT
+{
+    if (size_ == capacity())
+        grow();
+
+    std::construct_at(std::next(data(), size_++), std::move(value));
+}
+
+TEMPLATE
+template <typename ...Args>
+inline Type& CLASS::
+emplace_back(Args&&... args) NOEXCEPT
+{
+    if (size_ == capacity())
+        grow();
+
+    return *std::construct_at(std::next(data(), size_++),
+        std::forward<Args>(args)...);
+}
+
+TEMPLATE
+inline void CLASS::
+pop_back() NOEXCEPT
+{
+    BC_ASSERT(!empty());
+    --size_;
+}
+
+// Shift of trivial elements reduces to a single memmove.
+TEMPLATE
+inline typename CLASS::iterator CLASS::
+erase(const_iterator position) NOEXCEPT
+{
+    BC_ASSERT(position >= begin() && position < end());
+    const auto target = std::next(begin(), position - data());
+    std::move(std::next(target), end(), target);
+    --size_;
+    return target;
+}
+
+TEMPLATE
+inline void CLASS::
+clear() NOEXCEPT
+{
+    size_ = zero;
+}
+
+// Iteration.
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+inline typename CLASS::iterator CLASS::
+begin() NOEXCEPT
+{
+    return data();
+}
+
+TEMPLATE
+inline typename CLASS::iterator CLASS::
+end() NOEXCEPT
+{
+    return std::next(data(), size_);
+}
+
+TEMPLATE
+inline typename CLASS::const_iterator CLASS::
+begin() const NOEXCEPT
+{
+    return data();
+}
+
+TEMPLATE
+inline typename CLASS::const_iterator CLASS::
+end() const NOEXCEPT
+{
+    return std::next(data(), size_);
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+inline void CLASS::
+grow() NOEXCEPT
+{
+    std_vector<Type> heap(two * capacity());
+    std::move(begin(), end(), heap.begin());
+    heap_ = std::move(heap);
+}
+
+TEMPLATE
+inline void CLASS::
+assign_inline(const inline_vector& other) NOEXCEPT
+{
+    if (is_inline())
+        std::uninitialized_copy_n(other.inline_.data(), size_,
+            inline_.data());
+}
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
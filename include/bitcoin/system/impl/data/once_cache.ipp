@@ -0,0 +1,159 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_DATA_ONCE_CACHE_IPP
+#define LIBBITCOIN_SYSTEM_DATA_ONCE_CACHE_IPP
+
+#include <atomic>
+#include <thread>
+#include <utility>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+TEMPLATE
+inline CLASS::
+once_cache() NOEXCEPT
+  : state_{ unset }, value_{}
+{
+}
+
+TEMPLATE
+inline CLASS::
+once_cache(const once_cache& other) NOEXCEPT
+  : state_{ unset }, value_{}
+{
+    assign(other);
+}
+
+TEMPLATE
+inline CLASS::
+once_cache(once_cache&& other) NOEXCEPT
+  : state_{ unset }, value_{}
+{
+    assign(other);
+}
+
+TEMPLATE
+inline CLASS& CLASS::
+operator=(const once_cache& other) NOEXCEPT
+{
+    if (this != &other)
+        assign(other);
+
+    return *this;
+}
+
+TEMPLATE
+inline CLASS& CLASS::
+operator=(once_cache&& other) NOEXCEPT
+{
+    if (this != &other)
+        assign(other);
+
+    return *this;
+}
+
+// Properties.
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+inline CLASS::
+operator bool() const NOEXCEPT
+{
+    return state_.load(std::memory_order_acquire) == full;
+}
+
+TEMPLATE
+inline const Type& CLASS::
+operator*() const NOEXCEPT
+{
+    return value_;
+}
+
+TEMPLATE
+inline const Type* CLASS::
+operator->() const NOEXCEPT
+{
+    return &value_;
+}
+
+// Methods.
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+template <typename Factory>
+inline const Type& CLASS::
+get(Factory&& factory) NOEXCEPT
+{
+    if (state_.load(std::memory_order_acquire) == full)
+        return value_;
+
+    // The winner computes the value, and it is published by release.
+    uint8_t expected{ unset };
+    if (state_.compare_exchange_strong(expected, busy,
+        std::memory_order_acquire))
+    {
+        value_ = std::forward<Factory>(factory)();
+        state_.store(full, std::memory_order_release);
+        return value_;
+    }
+
+    // Others wait on the winner, which computes without blocking.
+    while (state_.load(std::memory_order_acquire) != full)
+        std::this_thread::yield();
+
+    return value_;
+}
+
+TEMPLATE
+inline void CLASS::
+set(const Type& value) NOEXCEPT
+{
+    value_ = value;
+    state_.store(full, std::memory_order_release);
+}
+
+TEMPLATE
+inline void CLASS::
+set(Type&& value) NOEXCEPT
+{
+    value_ = std::move(value);
+    state_.store(full, std::memory_order_release);
+}
+
+// private
+TEMPLATE
+inline void CLASS::
+assign(const once_cache& other) NOEXCEPT
+{
+    if (other)
+    {
+        set(other.value_);
+        return;
+    }
+
+    value_ = Type{};
+    state_.store(unset, std::memory_order_release);
+}
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,385 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_DATA_RING_BUFFER_IPP
+#define LIBBITCOIN_SYSTEM_DATA_RING_BUFFER_IPP
+
+#include <algorithm>
+#include <bit>
+#include <initializer_list>
+#include <utility>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+TEMPLATE
+inline CLASS::
+ring_buffer() NOEXCEPT
+  : buffer_{}, head_{}, size_{}
+{
+}
+
+TEMPLATE
+inline CLASS::
+ring_buffer(size_t capacity) NOEXCEPT
+  : ring_buffer()
+{
+    reserve(capacity);
+}
+
+TEMPLATE
+inline CLASS::
+ring_buffer(std::initializer_list<Type> values) NOEXCEPT
+  : ring_buffer(values.size())
+{
+    for (const auto& value: values)
+        push_back(value);
+}
+
+// Capacity.
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+inline void CLASS::
+reserve(size_t capacity) NOEXCEPT
+{
+    if (capacity <= buffer_.size())
+        return;
+
+    // Linearize into new power of two buffer, oldest element at zero.
+    std_vector<Type> buffer(std::bit_ceil(capacity));
+    for (size_t index = 0; index < size_; ++index)
+        buffer[index] = std::move(buffer_[position(index)]);
+
+    buffer_ = std::move(buffer);
+    head_ = zero;
+}
+
+TEMPLATE
+inline void CLASS::
+resize(size_t size) NOEXCEPT
+{
+    resize(size, Type{});
+}
+
+TEMPLATE
+inline void CLASS::
+resize(size_t size, const Type& value) NOEXCEPT
+{
+    while (size_ > size)
+        pop_back();
+
+    reserve(size);
+    while (size_ < size)
+        push_back(value);
+}
+
+TEMPLATE
+inline size_t CLASS::
+capacity() const NOEXCEPT
+{
+    return buffer_.size();
+}
+
+TEMPLATE
+inline size_t CLASS::
+size() const NOEXCEPT
+{
+    return size_;
+}
+
+TEMPLATE
+inline bool CLASS::
+empty() const NOEXCEPT
+{
+    return is_zero(size_);
+}
+
+TEMPLATE
+inline bool CLASS::
+full() const NOEXCEPT
+{
+    return size_ == buffer_.size();
+}
+
+// Element access.
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+inline Type& CLASS::
+operator[](size_t index) NOEXCEPT
+{
+    BC_ASSERT(index < size_);
+    return buffer_[position(index)];
+}
+
+TEMPLATE
+inline const Type& CLASS::
+operator[](size_t index) const NOEXCEPT
+{
+    BC_ASSERT(index < size_);
+    return buffer_[position(index)];
+}
+
+TEMPLATE
+inline Type& CLASS::
+front() NOEXCEPT
+{
+    return (*this)[zero];
+}
+
+TEMPLATE
+inline const Type& CLASS::
+front() const NOEXCEPT
+{
+    return (*this)[zero];
+}
+
+TEMPLATE
+inline Type& CLASS::
+back() NOEXCEPT
+{
+    return (*this)[sub1(size_)];
+}
+
+TEMPLATE
+inline const Type& CLASS::
+back() const NOEXCEPT
+{
+    return (*this)[sub1(size_)];
+}
+
+// Modifiers.
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+inline void CLASS::
+push_front(const Type& value) NOEXCEPT
+{
+    if (full())
+        grow();
+
+    // Capacity is a power of two, so the last position precedes the head.
+    head_ = position(sub1(buffer_.size()));
+    buffer_[head_] = value;
+    ++size_;
+}
+
+TEMPLATE
+inline void CLASS::
+push_front(Type&& value) NOEXCEPT
+{
+    if (full())
+        grow();
+
+    head_ = position(sub1(buffer_.size()));
+    buffer_[head_] = std::move(value);
+    ++size_;
+}
+
+TEMPLATE
+inline void CLASS::
+push_back(const Type& value) NOEXCEPT
+{
+    if (full())
+        grow();
+
+    buffer_[position(size_++)] = value;
+}
+
+TEMPLATE
+inline void CLASS::
+push_back(Type&& value) NOEXCEPT
+{
+    if (full())
+        grow();
+
+    buffer_[position(size_++)] = std::move(value);
+}
+
+TEMPLATE
+inline void CLASS::
+pop_front() NOEXCEPT
+{
+    BC_ASSERT(!empty());
+    buffer_[head_] = Type{};
+    head_ = position(one);
+    --size_;
+}
+
+TEMPLATE
+inline void CLASS::
+pop_back() NOEXCEPT
+{
+    BC_ASSERT(!empty());
+    buffer_[position(--size_)] = Type{};
+}
+
+TEMPLATE
+inline void CLASS::
+clear() NOEXCEPT
+{
+    std::fill(buffer_.begin(), buffer_.end(), Type{});
+    head_ = zero;
+    size_ = zero;
+}
+
+// Insertion.
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+inline typename CLASS::iterator CLASS::
+insert(const_iterator where, const Type& value) NOEXCEPT
+{
+    const auto index = where - cbegin();
+    push_back(value);
+    std::rotate(std::next(begin(), index), std::prev(end()), end());
+    return std::next(begin(), index);
+}
+
+TEMPLATE
+template <typename Iterator>
+inline typename CLASS::iterator CLASS::
+insert(const_iterator where, Iterator first, Iterator last) NOEXCEPT
+{
+    const auto index = where - cbegin();
+    const auto size = size_;
+    for (auto it = first; it != last; ++it)
+        push_back(*it);
+
+    std::rotate(std::next(begin(), index), std::next(begin(), size), end());
+    return std::next(begin(), index);
+}
+
+// Iteration.
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+inline typename CLASS::iterator CLASS::
+begin() NOEXCEPT
+{
+    return { this, zero };
+}
+
+TEMPLATE
+inline typename CLASS::iterator CLASS::
+end() NOEXCEPT
+{
+    return { this, size_ };
+}
+
+TEMPLATE
+inline typename CLASS::const_iterator CLASS::
+begin() const NOEXCEPT
+{
+    return { this, zero };
+}
+
+TEMPLATE
+inline typename CLASS::const_iterator CLASS::
+end() const NOEXCEPT
+{
+    return { this, size_ };
+}
+
+TEMPLATE
+inline typename CLASS::const_iterator CLASS::
+cbegin() const NOEXCEPT
+{
+    return begin();
+}
+
+TEMPLATE
+inline typename CLASS::const_iterator CLASS::
+cend() const NOEXCEPT
+{
+    return end();
+}
+
+TEMPLATE
+inline typename CLASS::reverse_iterator CLASS::
+rbegin() NOEXCEPT
+{
+    return reverse_iterator{ end() };
+}
+
+TEMPLATE
+inline typename CLASS::reverse_iterator CLASS::
+rend() NOEXCEPT
+{
+    return reverse_iterator{ begin() };
+}
+
+TEMPLATE
+inline typename CLASS::const_reverse_iterator CLASS::
+rbegin() const NOEXCEPT
+{
+    return const_reverse_iterator{ end() };
+}
+
+TEMPLATE
+inline typename CLASS::const_reverse_iterator CLASS::
+rend() const NOEXCEPT
+{
+    return const_reverse_iterator{ begin() };
+}
+
+TEMPLATE
+inline typename CLASS::const_reverse_iterator CLASS::
+crbegin() const NOEXCEPT
+{
+    return rbegin();
+}
+
+TEMPLATE
+inline typename CLASS::const_reverse_iterator CLASS::
+crend() const NOEXCEPT
+{
+    return rend();
+}
+
+TEMPLATE
+inline bool CLASS::
+operator==(const ring_buffer& other) const NOEXCEPT
+{
+    return std::equal(begin(), end(), other.begin(), other.end());
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+inline size_t CLASS::
+position(size_t index) const NOEXCEPT
+{
+    // Capacity is a power of two, so masking is modulo.
+    return (head_ + index) & sub1(buffer_.size());
+}
+
+TEMPLATE
+inline void CLASS::
+grow() NOEXCEPT
+{
+    reserve(is_zero(buffer_.size()) ? one : shift_left(buffer_.size()));
+}
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
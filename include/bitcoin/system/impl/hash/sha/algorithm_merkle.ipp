@@ -24,6 +24,7 @@
 // Merkle hashing.
 // ============================================================================
 // No merkle_hash optimizations for sha160 (double_hash requires half_t).
+// Tagged hashing of digest pairs shares the merkle vectorization helpers.
 
 namespace libbitcoin {
 namespace system {
@@ -420,6 +421,122 @@ merkle_hash_vector(digests_t& digests) NOEXCEPT
     merkle_hash_(digests, next);
 }
 
+// vectorizable tagged digest pairs hashing
+// ----------------------------------------------------------------------------
+// protected
+
+TEMPLATE
+template <typename xWord>
+INLINE void CLASS::
+schedule_2(xbuffer_t<xWord>& xbuffer) NOEXCEPT
+{
+    // Tagged pairs follow the tag block, so padding is for two blocks.
+    static const auto xscheduled_pad = []() NOEXCEPT
+    {
+        constexpr auto pad = scheduled_pad<two>();
+        xbuffer_t<xWord> out{};
+        for (size_t round = 0; round < SHA::rounds; ++round)
+            out[round] = f::broadcast<xWord>(pad[round]);
+
+        return out;
+    }();
+
+    xbuffer = xscheduled_pad;
+}
+
+TEMPLATE
+void CLASS::
+tagged_hash_(digests_t& digests, const state_t& midstate,
+    size_t offset) NOEXCEPT
+{
+    const auto blocks = to_half(digests.size());
+    for (auto i = offset, j = offset * two; i < blocks; ++i, j += two)
+    {
+        auto state = midstate;
+        buffer_t buffer{};
+        input_left(buffer, digests[j]);
+        input_right(buffer, digests[add1(j)]);
+        schedule(buffer);
+        compress(state, buffer);
+        schedule_n<two>(buffer);
+        compress(state, buffer);
+        digests[i] = output(state);
+    }
+
+    digests.resize(blocks);
+}
+
+TEMPLATE
+template <typename xWord, if_extended<xWord>>
+INLINE void CLASS::
+tagged_hash_vector(idigests_t& digests, iblocks_t& blocks,
+    const state_t& midstate) NOEXCEPT
+{
+    BC_ASSERT(digests.size() == blocks.size());
+    constexpr auto lanes = capacity<xWord, word_t>;
+    static_assert(is_valid_lanes<lanes>);
+
+    if constexpr (have<xWord>)
+    {
+        if (blocks.size() >= lanes)
+        {
+            const auto initial = pack<xWord>(midstate);
+            xbuffer_t<xWord> xbuffer{};
+
+            do
+            {
+                auto xstate = initial;
+
+                // xinput() advances block iterator by lanes.
+                xinput(xbuffer, blocks);
+                schedule_(xbuffer);
+                compress_(xstate, xbuffer);
+                schedule_2(xbuffer);
+                compress_(xstate, xbuffer);
+
+                // xoutput() advances digest iterator by lanes.
+                xoutput(digests, xstate);
+            }
+            while (blocks.size() >= lanes);
+        }
+    }
+}
+
+TEMPLATE
+INLINE void CLASS::
+tagged_hash_vector(digests_t& digests, const state_t& midstate) NOEXCEPT
+{
+    static_assert(sizeof(digest_t) == to_half(sizeof(block_t)));
+    auto next = zero;
+
+    if (digests.size() >= min_lanes * two)
+    {
+        const auto data = digests.front().data();
+        const auto size = digests.size() * array_count<digest_t>;
+        auto iblocks = iblocks_t{ size, data };
+        auto idigests = idigests_t{ to_half(size), data };
+        const auto start = iblocks.size();
+
+        // Always use if available.
+        if constexpr (use_512)
+            tagged_hash_vector<xint512_t>(idigests, iblocks, midstate);
+
+        // Only use if shani is not available.
+        if constexpr (use_256 && !native)
+            tagged_hash_vector<xint256_t>(idigests, iblocks, midstate);
+
+        // Only use if shani is not available.
+        if constexpr (use_128 && !native)
+            tagged_hash_vector<xint128_t>(idigests, iblocks, midstate);
+
+        // iblocks.size() is reduced by vectorization.
+        next = start - iblocks.size();
+    }
+
+    // Complete pairs using normal form.
+    tagged_hash_(digests, midstate, next);
+}
+
 // interface
 // ----------------------------------------------------------------------------
 // public
@@ -472,6 +589,27 @@ merkle_hash(digests_t& digests) NOEXCEPT
     return digests;
 };
 
+TEMPLATE
+typename CLASS::digests_t& CLASS::
+tagged_hash(digests_t& digests, const state_t& midstate) NOEXCEPT
+{
+    static_assert(is_same_type<state_t, chunk_t>);
+    BC_ASSERT(is_even(digests.size()));
+
+    // Pairs are vectorized at 16/8/4 lanes (as available) and fall back to
+    // normal form for the remainder, each from the given tag midstate.
+    if constexpr (vector)
+    {
+        tagged_hash_vector(digests, midstate);
+    }
+    else
+    {
+        tagged_hash_(digests, midstate);
+    }
+
+    return digests;
+}
+
 } // namespace sha
 } // namespace system
 } // namespace libbitcoin
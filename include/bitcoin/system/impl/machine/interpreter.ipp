@@ -1037,7 +1037,7 @@ op_check_sig_verify() NOEXCEPT
                 return error::op_check_sig_verify4;
 
             // Verify schnorr signature against public key and signature hash.
-            if (!schnorr::verify_signature(*key, hash, sig))
+            if (!state::verify_schnorr(*key, hash, sig))
                 return error::op_check_sig_verify5;
 
             // If signature not empty, opcode counted toward sigops budget.
@@ -1071,7 +1071,7 @@ op_check_sig_verify() NOEXCEPT
         return error::op_check_sig_verify8;
 
     // Verify ECDSA signature against public key and signature hash.
-    if (!ecdsa::verify_signature(*key, hash, sig))
+    if (!state::verify_ecdsa(*key, hash, sig))
         return error::op_check_sig_verify9;
 
     // TODO: use sighash and key to generate signature in sign mode.
@@ -1144,6 +1144,13 @@ op_check_multisig_verify() NOEXCEPT
     const auto subscript = state::subscript(endorsements);
     const auto bip66 = state::is_enabled(flags::bip66_rule);
 
+    // Ordered verification costs up to one verify per key, where recovery
+    // costs about two per endorsement, and then matches keys by comparison.
+    // Recovery is applied only when it is expected to reduce total cost.
+    const auto recover = (two * endorsements.size()) < keys.size();
+    uncompressed_list candidates{};
+    auto recovered = false;
+
     // Keys may be empty.
     for (const auto& key: keys)
     {
@@ -1171,8 +1178,33 @@ op_check_multisig_verify() NOEXCEPT
                 return error::op_check_multisig_verify10;
 
         // Verify ECDSA signature against public key and cache signature hash.
-        if (ecdsa::verify_signature(*key, state::cached_hash(), sig))
+        if (!recover)
+        {
+            if (state::verify_ecdsa(*key, state::cached_hash(), sig))
+                ++it;
+
+            continue;
+        }
+
+        // Match public key to points recovered once for each endorsement.
+        // Recovery is exhaustive, so key matching has the same outcome as
+        // ordered verification, including for keys that fail to parse.
+        if (!recovered)
+            recovered = state::recover_ecdsa(candidates, state::cached_hash(),
+                sig);
+
+        if (recovered)
+        {
+            if (state::match_ecdsa(*key, candidates, state::cached_hash(), sig))
+            {
+                recovered = false;
+                ++it;
+            }
+        }
+        else if (state::verify_ecdsa(*key, state::cached_hash(), sig))
+        {
             ++it;
+        }
     }
 
     // All endorsements must be verified against a key.
@@ -1311,7 +1343,7 @@ op_check_sig_add() NOEXCEPT
         return error::op_check_schnorr_sig5;
 
     // Verify schnorr signature against public key and signature hash.
-    if (!schnorr::verify_signature(*key, hash, sig))
+    if (!state::verify_schnorr(*key, hash, sig))
         return error::op_check_schnorr_sig6;
 
     // If signature not empty, opcode counted toward sigops budget.
@@ -25,6 +25,8 @@
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/error/error.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/machine/number.hpp>
 
 namespace libbitcoin {
 namespace system {
@@ -47,7 +49,28 @@ connect(const chain::context& state, const chain::transaction& tx,
 TEMPLATE
 code CLASS::
 connect(const chain::context& state, const chain::transaction& tx,
-    const input_iterator& it) NOEXCEPT
+    const input_iterator& it,
+    const chain::taproot::commitment* verified) NOEXCEPT
+{
+    // Standard scripts bypass operation dispatch, with identical result.
+    code ec{};
+#if defined(HAVE_PROFILE)
+    if (profile_standard(ec, state, tx, it))
+        return ec;
+#else
+    if (connect_standard(ec, state, tx, it))
+        return ec;
+#endif
+
+    return connect_generic(state, tx, it, verified);
+}
+
+// static/protected
+TEMPLATE
+code CLASS::
+connect_generic(const chain::context& state, const chain::transaction& tx,
+    const input_iterator& it,
+    const chain::taproot::commitment* verified) NOEXCEPT
 {
     using namespace chain;
     const auto& input = **it;
@@ -84,7 +107,8 @@ connect(const chain::context& state, const chain::transaction& tx,
             return error::dirty_witness;
 
         // Because output script pushed version and witness program [bip141].
-        if ((ec = connect_witness(state, tx, it, *prevout, false)))
+        if ((ec = connect_witness(state, tx, it, *prevout, false,
+            verified)))
             return ec;
     }
     else if (!input.witness().stack().empty())
@@ -96,6 +120,214 @@ connect(const chain::context& state, const chain::transaction& tx,
     return error::script_success;
 }
 
+// Standard scripts.
+// ----------------------------------------------------------------------------
+// Each handler accepts only inputs for which every generic evaluation step
+// other than signature validation is known to succeed or to fail with a
+// specific code. Operation handlers are shared with the generic evaluation,
+// so signature validation and its error codes are unchanged. Inputs outside
+// of these constraints are not handled and fall back to generic evaluation.
+
+// static/protected
+TEMPLATE
+bool CLASS::
+connect_standard(code& ec, const chain::context& state,
+    const chain::transaction& tx, const input_iterator& it) NOEXCEPT
+{
+    using namespace chain;
+    const auto& input = **it;
+    if (!input.prevout)
+        return false;
+
+    const auto& prevout = input.prevout->script();
+    if (script::is_pay_key_hash_pattern(prevout.ops()))
+        return connect_key_hash(ec, state, tx, it);
+
+    if (!prevout.is_pay_to_witness(state.flags))
+        return false;
+
+    switch (prevout.version())
+    {
+        case script_version::segwit:
+            return connect_witness_key_hash(ec, state, tx, it);
+        case script_version::taproot:
+            return connect_taproot_key(ec, state, tx, it);
+        default:
+            return false;
+    }
+}
+
+#if defined(HAVE_PROFILE)
+// static/protected
+TEMPLATE
+bool CLASS::
+profile_standard(code& ec, const chain::context& state,
+    const chain::transaction& tx, const input_iterator& it) NOEXCEPT
+{
+    using namespace chain;
+    const auto profile = profiler::current();
+    if (is_null(profile))
+        return connect_standard(ec, state, tx, it);
+
+    const auto start = profiler::now();
+    if (!connect_standard(ec, state, tx, it))
+        return false;
+
+    // Handled, so the prevout is one of the standard templates.
+    const auto cycles = profiler::now() - start;
+    const auto& prevout = (*it)->prevout->script();
+    if (script::is_pay_key_hash_pattern(prevout.ops()))
+        profile->input(profiler::standard::key_hash, cycles);
+    else if (prevout.version() == script_version::segwit)
+        profile->input(profiler::standard::witness_key_hash, cycles);
+    else
+        profile->input(profiler::standard::taproot_key, cycles);
+
+    return true;
+}
+#endif
+
+// static/protected
+TEMPLATE
+bool CLASS::
+connect_key_hash(code& ec, const chain::context& state,
+    const chain::transaction& tx, const input_iterator& it) NOEXCEPT
+{
+    using namespace chain;
+    const auto& input = **it;
+    const auto& ops = input.script().ops();
+    const auto& prevout = input.prevout->script_ptr();
+    const auto& hash = prevout->ops()[2];
+
+    // input script  : <signature> <public-key>
+    // output script : dup hash160 <20-byte-hash> equalverify checksig
+    const auto is_push = [](const operation& op) NOEXCEPT
+    {
+        return op.is_payload() && !op.is_underclaimed() && !op.is_oversized();
+    };
+
+    // Pushes cannot fail and a witness would be unexpected [bip141].
+    if (ops.size() != two || !is_push(ops.front()) || !is_push(ops.back()) ||
+        hash.code() != opcode::push_size_20 ||
+        !input.witness().stack().empty())
+        return false;
+
+    // Input script evaluation is reduced to its two pushes.
+    interpreter in_program(tx, it, state.flags);
+    interpreter program(in_program, prevout);
+    program.push_chunk(ops.front().data_ptr());
+    program.push_chunk(ops.back().data_ptr());
+
+    // dup hash160 <20-byte-hash> equalverify
+    const auto& key = ops.back().data();
+    if (bitcoin_short_hash(key) !=
+        unsafe_array_cast<uint8_t, short_hash_size>(hash.data().data()))
+    {
+        ec = error::op_equal_verify2;
+        return true;
+    }
+
+    // checksig
+    if ((ec = program.op_check_sig()))
+        return true;
+
+    ec = program.is_true(false) ? error::script_success : error::stack_false;
+    return true;
+}
+
+// static/protected
+TEMPLATE
+bool CLASS::
+connect_witness_key_hash(code& ec, const chain::context& state,
+    const chain::transaction& tx, const input_iterator& it) NOEXCEPT
+{
+    using namespace chain;
+    const auto& input = **it;
+    const auto& prevout = input.prevout->script();
+    const auto& witness = input.witness();
+    const auto& hash = prevout.witness_program();
+
+    // witness stack : <signature> <public-key>
+    // input script  : (empty)
+    // output script : <0> <20-byte-hash-of-public-key>
+    if (hash->size() != short_hash_size ||
+        !number::boolean::from_chunk(*hash) ||
+        !input.script().ops().empty() ||
+        witness.stack().size() != two)
+        return false;
+
+    script::cptr script;
+    chunk_cptrs_ptr stack;
+    if ((ec = witness.extract_segwit(script, stack, prevout)))
+        return true;
+
+    interpreter program(tx, it, script, state.flags, script_version::segwit,
+        stack);
+    if ((ec = program.initialize()))
+        return true;
+
+    // dup hash160 <20-byte-hash> equalverify
+    if (bitcoin_short_hash(*witness.stack().back()) !=
+        unsafe_array_cast<uint8_t, short_hash_size>(hash->data()))
+    {
+        ec = error::op_equal_verify2;
+        return true;
+    }
+
+    // checksig
+    if ((ec = program.op_check_sig()))
+        return true;
+
+    ec = program.is_true(true) ? error::script_success : error::stack_false;
+    return true;
+}
+
+// static/protected
+TEMPLATE
+bool CLASS::
+connect_taproot_key(code& ec, const chain::context& state,
+    const chain::transaction& tx, const input_iterator& it) NOEXCEPT
+{
+    using namespace chain;
+    const auto& input = **it;
+    const auto& prevout = input.prevout->script();
+    const auto& witness = input.witness();
+    const auto& key = prevout.witness_program();
+
+    // witness stack : <signature>
+    // input script  : (empty)
+    // output script : <1> <32-byte-tweaked-public-key>
+    if (!script::is_enabled(state.flags, flags::bip341_rule) ||
+        key->size() != ec_xonly_size ||
+        !number::boolean::from_chunk(*key) ||
+        !input.script().ops().empty() ||
+        !is_one(witness.stack().size()))
+        return false;
+
+    hash_cptr tapleaf{};
+    script::cptr script;
+    chunk_cptrs_ptr stack;
+    if ((ec = witness.extract_taproot(tapleaf, script, stack, prevout)))
+        return true;
+
+    interpreter program(tx, it, script, state.flags, script_version::taproot,
+        stack, tapleaf);
+    if ((ec = program.initialize()))
+    {
+        if (ec == error::prevalid_script)
+            ec = error::script_success;
+
+        return true;
+    }
+
+    // checksig
+    if ((ec = program.op_check_sig()))
+        return true;
+
+    ec = program.is_true(true) ? error::script_success : error::stack_false;
+    return true;
+}
+
 // static/protected
 TEMPLATE
 code CLASS::connect_embedded(const chain::context& state,
@@ -129,7 +361,8 @@ code CLASS::connect_embedded(const chain::context& state,
             return error::dirty_witness;
 
         // Because output script pushed version/witness program [bip141].
-        if ((ec = connect_witness(state, tx, it, *embedded, true)))
+        if ((ec = connect_witness(state, tx, it, *embedded, true,
+            nullptr)))
             return ec;
     }
     else if (!input.witness().stack().empty())
@@ -145,7 +378,8 @@ code CLASS::connect_embedded(const chain::context& state,
 TEMPLATE
 code CLASS::connect_witness(const chain::context& state,
     const chain::transaction& tx, const input_iterator& it,
-    const chain::script& prevout, bool embedded) NOEXCEPT
+    const chain::script& prevout, bool embedded,
+    const chain::taproot::commitment* verified) NOEXCEPT
 {
     using namespace chain;
     const auto& input = **it;
@@ -192,7 +426,7 @@ code CLASS::connect_witness(const chain::context& state,
             script::cptr script;
             chunk_cptrs_ptr stack;
             if ((ec = input.witness().extract_taproot(tapleaf, script, stack,
-                prevout)))
+                prevout, verified)))
                 return ec;
 
             interpreter program(tx, it, script, flags, version, stack, tapleaf);
@@ -53,8 +53,13 @@ run() NOEXCEPT
 
         if (state::if_(op))
         {
+#if defined(HAVE_PROFILE)
+            if (const auto ec = profile_op(it))
+                return ec;
+#else
             if (const auto ec = run_op(it))
                 return ec;
+#endif
 
             if (state::is_stack_overflow())
                 return error::invalid_stack_size;
@@ -67,6 +72,25 @@ run() NOEXCEPT
     return error::script_success;
 }
 
+#if defined(HAVE_PROFILE)
+// protected
+TEMPLATE
+error::op_error_t CLASS::
+profile_op(const op_iterator& op) NOEXCEPT
+{
+    const auto profile = profiler::current();
+    if (is_null(profile))
+        return run_op(op);
+
+    profile->trace(*op, state::stack_size());
+    const auto start = profiler::now();
+    const auto ec = run_op(op);
+    profile->op(op->code(), profiler::now() - start);
+    profile->depth(state::stack_size());
+    return ec;
+}
+#endif
+
 // Operation disatch.
 // ----------------------------------------------------------------------------
 // It is expected that the compiler will produce a very efficient jump table.
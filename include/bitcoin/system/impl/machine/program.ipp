@@ -124,6 +124,20 @@ TEMPLATE
 INLINE bool CLASS::
 is_enabled(flags flag) const NOEXCEPT
 {
+    // Specialized script rules fold to constants, except for bip342 which is
+    // masked from all but tapscript programs (so only known when inactive).
+    if constexpr (Rules != rules::dynamic)
+    {
+        if (to_bool(flag & rules::mask))
+        {
+            if (!to_bool(flag & Rules))
+                return false;
+
+            if (flag != flags::bip342_rule)
+                return true;
+        }
+    }
+
     return to_bool(flags_ & flag);
 }
 
@@ -19,6 +19,7 @@
 #ifndef LIBBITCOIN_SYSTEM_MACHINE_PROGRAM_SIGN_IPP
 #define LIBBITCOIN_SYSTEM_MACHINE_PROGRAM_SIGN_IPP
 
+#include <algorithm>
 #include <iterator>
 #include <bitcoin/system/chain/chain.hpp>
 #include <bitcoin/system/crypto/crypto.hpp>
@@ -142,11 +143,57 @@ create_strip_ops(const chunk_xptrs& endorsements) NOEXCEPT
 
 // static/private
 TEMPLATE
-INLINE chain::strippers CLASS::
-create_strip_ops(const chunk_xptr& endorsement) NOEXCEPT
+INLINE bool CLASS::
+is_strip_op(const operation& op, const chunk_xptr& endorsement) NOEXCEPT
 {
-    using namespace chain;
-    return { stripper{ endorsement }, stripper{ opcode::codeseparator } };
+    // Same as op == stripper{ endorsement }, but sizes are compared first.
+    const auto& data = op.data();
+    return data.size() == endorsement->size() &&
+        op.code() == operation::nominal_opcode_from_data(*endorsement) &&
+        data == *endorsement;
+}
+
+// private
+TEMPLATE
+inline bool CLASS::
+is_stripped(const op_iterator& start,
+    const chunk_xptrs& endorsements) const NOEXCEPT
+{
+    return stripped_.stripped && stripped_.offset == start &&
+        std::equal(stripped_.endorsements.begin(),
+            stripped_.endorsements.end(), endorsements.begin(),
+            endorsements.end(),
+            [](const data_chunk& left, const chunk_xptr& right) NOEXCEPT
+            {
+                return left == *right;
+            });
+}
+
+// private
+// Stripping is only reached when a strip op is present in the subscript. The
+// result is retained, as scripts that repeat endorsement pushes (and/or code
+// separators) otherwise create the same stripped copy for each signature op.
+TEMPLATE
+inline const chain::script::cptr& CLASS::
+strip(const op_iterator& start, const chunk_xptrs& endorsements) NOEXCEPT
+{
+    if (is_stripped(start, endorsements))
+        return stripped_.stripped;
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    stripped_.endorsements.clear();
+    for (const auto& endorsement: endorsements)
+        stripped_.endorsements.push_back(*endorsement);
+    BC_POP_WARNING()
+
+    // Create new script from stripped copy of subscript operations.
+    const auto stop = script_->ops().end();
+    const auto ops = create_strip_ops(endorsements);
+    stripped_.offset = start;
+    stripped_.stripped = to_shared<script>(difference<operations>(start, stop,
+        ops));
+
+    return stripped_.stripped;
 }
 
 // ****************************************************************************
@@ -157,46 +204,52 @@ create_strip_ops(const chunk_xptr& endorsement) NOEXCEPT
 // ****************************************************************************
 TEMPLATE
 inline chain::script::cptr CLASS::
-subscript(const chunk_xptrs& endorsements) const NOEXCEPT
+subscript(const chunk_xptrs& endorsements) NOEXCEPT
 {
     // bip141: establishes the version property.
     // bip143: op stripping is not applied to bip141 v0 scripts.
     if (is_enabled(flags::bip143_rule) && version_ == script_version::segwit)
         return script_;
 
-    // Transform into a set of endorsement push ops and one op_codeseparator.
-    const auto strip = create_strip_ops(endorsements);
     const auto stop = script_->ops().end();
     const op_iterator start{ script_->offset };
 
-    // If none of the strip ops are found, return the subscript.
-    if (!is_intersecting<operations>(start, stop, strip))
-        return script_;
-
-    // Create new script from stripped copy of subscript operations.
-    return to_shared<script>(difference<operations>(start, stop, strip));
+    // If none of the strip ops are found, return the subscript (no copy).
+    const auto found = std::any_of(start, stop,
+        [&](const operation& op) NOEXCEPT
+        {
+            return op.code() == opcode::codeseparator ||
+                std::any_of(endorsements.begin(), endorsements.end(),
+                    [&](const chunk_xptr& endorsement) NOEXCEPT
+                    {
+                        return is_strip_op(op, endorsement);
+                    });
+        });
+
+    return found ? strip(start, endorsements) : script_;
 }
 
 TEMPLATE
 inline chain::script::cptr CLASS::
-subscript(const chunk_xptr& endorsement) const NOEXCEPT
+subscript(const chunk_xptr& endorsement) NOEXCEPT
 {
     // bip141: establishes the version property.
     // bip143: op stripping is not applied to bip141 v0 scripts.
     if (is_enabled(flags::bip143_rule) && version_ == script_version::segwit)
         return script_;
 
-    // Transform into a set with one endorsement push op and op_codeseparator.
-    const auto strip = create_strip_ops(endorsement);
     const auto stop = script_->ops().end();
     const op_iterator start{ script_->offset };
 
-    // If none of the strip ops are found, return the subscript.
-    if (!is_intersecting<operations>(start, stop, strip))
-        return script_;
+    // If none of the strip ops are found, return the subscript (no copy).
+    const auto found = std::any_of(start, stop,
+        [&](const operation& op) NOEXCEPT
+        {
+            return op.code() == opcode::codeseparator ||
+                is_strip_op(op, endorsement);
+        });
 
-    // Create new script from stripped copy of subscript operations.
-    return to_shared<script>(difference<operations>(start, stop, strip));
+    return found ? strip(start, { endorsement }) : script_;
 }
 
 // Signature hashing.
@@ -214,10 +267,79 @@ INLINE bool CLASS::
 signature_hash(hash_digest& out, const script& subscript,
     uint8_t sighash_flags) const NOEXCEPT
 {
+#if defined(HAVE_PROFILE)
+    const profiler::timer timer{ profiler::event::sighash };
+#endif
     return transaction_.signature_hash(out, input_, subscript, value_,
         tapleaf_, version_, sighash_flags, flags_);
 }
 
+// Signature verification.
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+INLINE bool CLASS::
+verify_ecdsa(const data_slice& point, const hash_digest& hash,
+    const ec_signature& signature) NOEXCEPT
+{
+#if defined(HAVE_PROFILE)
+    const profiler::timer timer{ profiler::event::verify };
+#endif
+    return ecdsa::verify_signature(point, hash, signature);
+}
+
+TEMPLATE
+INLINE bool CLASS::
+verify_schnorr(const data_chunk& x_point, const hash_digest& hash,
+    const ec_signature& signature) NOEXCEPT
+{
+#if defined(HAVE_PROFILE)
+    const profiler::timer timer{ profiler::event::verify };
+#endif
+    return schnorr::verify_signature(x_point, hash, signature);
+}
+
+TEMPLATE
+INLINE bool CLASS::
+recover_ecdsa(uncompressed_list& out, const hash_digest& hash,
+    const ec_signature& signature) NOEXCEPT
+{
+#if defined(HAVE_PROFILE)
+    const profiler::timer timer{ profiler::event::verify };
+#endif
+    return ecdsa::recover_candidates(out, signature, hash);
+}
+
+TEMPLATE
+INLINE bool CLASS::
+match_ecdsa(const data_chunk& point, const uncompressed_list& candidates,
+    const hash_digest& hash, const ec_signature& signature) NOEXCEPT
+{
+    // A valid point verifies the signature if and only if it was recovered.
+    // An invalid point is never recovered, as it also never verifies.
+    if (is_uncompressed_key(point))
+        return std::any_of(candidates.begin(), candidates.end(),
+            [&](const ec_uncompressed& candidate) NOEXCEPT
+            {
+                return std::equal(candidate.begin(), candidate.end(),
+                    point.begin());
+            });
+
+    // Compressed serialization is prefix (y parity) and x coordinate.
+    if (is_compressed_key(point))
+        return std::any_of(candidates.begin(), candidates.end(),
+            [&](const ec_uncompressed& candidate) NOEXCEPT
+            {
+                const auto parity = bit_and(candidate.back(), 1_u8);
+                return point.front() == bit_or(ec_even_sign, parity) &&
+                    std::equal(std::next(point.begin()), point.end(),
+                        std::next(candidate.begin()));
+            });
+
+    // Hybrid (and malformed) encodings are not compared, so are verified.
+    return verify_ecdsa(point, hash, signature);
+}
+
 // Multisig signature hash caching.
 // ----------------------------------------------------------------------------
 
@@ -0,0 +1,633 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_MATH_UINT256_IPP
+#define LIBBITCOIN_SYSTEM_MATH_UINT256_IPP
+
+#include <bit>
+#include <compare>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/bits.hpp>
+#include <bitcoin/system/math/cast.hpp>
+#include <bitcoin/system/math/division.hpp>
+#include <bitcoin/system/math/sign.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+// Limb indexation is guarded by construction and loop bounds.
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+
+// Construct.
+// ----------------------------------------------------------------------------
+
+constexpr uint256::uint256() NOEXCEPT
+  : words_{}
+{
+}
+
+constexpr uint256::uint256(limb value) NOEXCEPT
+  : words_{ value, 0, 0, 0 }
+{
+}
+
+constexpr uint256::uint256(const limbs_type& value) NOEXCEPT
+  : words_{ value }
+{
+}
+
+inline uint256::uint256(const uint256_t& value) NOEXCEPT
+  : words_{}
+{
+    // Masked as uintx narrowing conversion is not specified as truncation.
+    static const uint256_t mask{ max_uint64 };
+    for (size_t index = 0; index < limbs; ++index)
+        words_[index] = static_cast<limb>((value >> to_bits(
+            index * sizeof(limb))) & mask);
+}
+
+inline uint256::operator uint256_t() const NOEXCEPT
+{
+    uint256_t value{ words_[3] };
+    for (auto index = sub1(limbs); !is_zero(index); --index)
+    {
+        value <<= bits / limbs;
+        value |= words_[sub1(index)];
+    }
+
+    return value;
+}
+
+constexpr uint256 uint256::from_little_endian(const bytes_type& data) NOEXCEPT
+{
+    uint256 value{};
+    for (size_t byte = 0; byte < bytes; ++byte)
+        value.words_[byte / sizeof(limb)] |= shift_left<limb>(data[byte],
+            to_bits(byte % sizeof(limb)));
+
+    return value;
+}
+
+constexpr uint256::bytes_type uint256::to_little_endian() const NOEXCEPT
+{
+    bytes_type data{};
+    for (size_t byte = 0; byte < bytes; ++byte)
+        data[byte] = narrow_cast<uint8_t>(shift_right(
+            words_[byte / sizeof(limb)], to_bits(byte % sizeof(limb))));
+
+    return data;
+}
+
+// Properties.
+// ----------------------------------------------------------------------------
+
+constexpr const uint256::limbs_type& uint256::words() const NOEXCEPT
+{
+    return words_;
+}
+
+constexpr uint256::limb uint256::low() const NOEXCEPT
+{
+    return words_[0];
+}
+
+constexpr size_t uint256::bit_width() const NOEXCEPT
+{
+    for (auto index = limbs; !is_zero(index); --index)
+        if (!is_zero(words_[sub1(index)]))
+            return to_bits(sub1(index) * sizeof(limb)) +
+                std::bit_width(words_[sub1(index)]);
+
+    return zero;
+}
+
+// Comparison.
+// ----------------------------------------------------------------------------
+
+constexpr bool uint256::operator==(const uint256& other) const NOEXCEPT
+{
+    return words_ == other.words_;
+}
+
+constexpr std::strong_ordering uint256::operator<=>(
+    const uint256& other) const NOEXCEPT
+{
+    // Most significant limb first.
+    for (auto index = limbs; !is_zero(index); --index)
+        if (words_[sub1(index)] != other.words_[sub1(index)])
+            return words_[sub1(index)] <=> other.words_[sub1(index)];
+
+    return std::strong_ordering::equal;
+}
+
+// Bitwise.
+// ----------------------------------------------------------------------------
+
+constexpr uint256 uint256::operator~() const NOEXCEPT
+{
+    return uint256{ limbs_type{ ~words_[0], ~words_[1], ~words_[2],
+        ~words_[3] } };
+}
+
+constexpr uint256& uint256::operator&=(const uint256& other) NOEXCEPT
+{
+    for (size_t index = 0; index < limbs; ++index)
+        words_[index] &= other.words_[index];
+
+    return *this;
+}
+
+constexpr uint256& uint256::operator|=(const uint256& other) NOEXCEPT
+{
+    for (size_t index = 0; index < limbs; ++index)
+        words_[index] |= other.words_[index];
+
+    return *this;
+}
+
+constexpr uint256& uint256::operator^=(const uint256& other) NOEXCEPT
+{
+    for (size_t index = 0; index < limbs; ++index)
+        words_[index] ^= other.words_[index];
+
+    return *this;
+}
+
+constexpr uint256& uint256::operator<<=(size_t shift) NOEXCEPT
+{
+    constexpr auto width = bits / limbs;
+    const auto offset = shift / width;
+    const auto bit = shift % width;
+
+    for (auto index = limbs; !is_zero(index); --index)
+    {
+        const auto to = sub1(index);
+        if (to < offset)
+        {
+            words_[to] = 0;
+            continue;
+        }
+
+        const auto from = to - offset;
+        words_[to] = shift_left(words_[from], bit) | (is_zero(bit) ||
+            is_zero(from) ? 0 : shift_right(words_[sub1(from)], width - bit));
+    }
+
+    return *this;
+}
+
+constexpr uint256& uint256::operator>>=(size_t shift) NOEXCEPT
+{
+    constexpr auto width = bits / limbs;
+    const auto offset = shift / width;
+    const auto bit = shift % width;
+
+    for (size_t to = 0; to < limbs; ++to)
+    {
+        const auto from = to + offset;
+        if (from >= limbs)
+        {
+            words_[to] = 0;
+            continue;
+        }
+
+        words_[to] = shift_right(words_[from], bit) | (is_zero(bit) ||
+            add1(from) == limbs ? 0 :
+            shift_left(words_[add1(from)], width - bit));
+    }
+
+    return *this;
+}
+
+// Arithmetic.
+// ----------------------------------------------------------------------------
+
+constexpr uint256& uint256::operator++() NOEXCEPT
+{
+    for (size_t index = 0; index < limbs; ++index)
+        if (!is_zero(++words_[index]))
+            break;
+
+    return *this;
+}
+
+constexpr uint256& uint256::operator--() NOEXCEPT
+{
+    for (size_t index = 0; index < limbs; ++index)
+        if (words_[index]-- != 0)
+            break;
+
+    return *this;
+}
+
+constexpr uint256 uint256::operator++(int) NOEXCEPT
+{
+    const auto copy{ *this };
+    ++(*this);
+    return copy;
+}
+
+constexpr uint256 uint256::operator--(int) NOEXCEPT
+{
+    const auto copy{ *this };
+    --(*this);
+    return copy;
+}
+
+constexpr uint256& uint256::operator+=(const uint256& other) NOEXCEPT
+{
+    limb carry{};
+    for (size_t index = 0; index < limbs; ++index)
+    {
+        const auto sum = words_[index] + other.words_[index];
+        const auto total = sum + carry;
+        carry = to_int<limb>(sum < words_[index]) + to_int<limb>(total < sum);
+        words_[index] = total;
+    }
+
+    return *this;
+}
+
+constexpr uint256& uint256::operator-=(const uint256& other) NOEXCEPT
+{
+    limb borrow{};
+    for (size_t index = 0; index < limbs; ++index)
+    {
+        const auto difference = words_[index] - other.words_[index];
+        const auto total = difference - borrow;
+        borrow = to_int<limb>(difference > words_[index]) +
+            to_int<limb>(total > difference);
+        words_[index] = total;
+    }
+
+    return *this;
+}
+
+constexpr uint256& uint256::operator*=(const uint256& other) NOEXCEPT
+{
+    // Schoolbook, truncated to the low four limbs of the product.
+    limbs_type product{};
+    for (size_t left = 0; left < limbs; ++left)
+    {
+        limb carry{};
+        for (size_t right = 0; left + right < limbs; ++right)
+        {
+            auto& out = product[left + right];
+            out = multiply(carry, words_[left], other.words_[right], out,
+                carry);
+        }
+    }
+
+    words_ = product;
+    return *this;
+}
+
+constexpr uint256& uint256::operator/=(const uint256& other) NOEXCEPT
+{
+    uint256 remainder{};
+    divide(*this, remainder, uint256{ *this }, other);
+    return *this;
+}
+
+constexpr uint256& uint256::operator%=(const uint256& other) NOEXCEPT
+{
+    uint256 quotient{};
+    divide(quotient, *this, uint256{ *this }, other);
+    return *this;
+}
+
+// Division.
+// ----------------------------------------------------------------------------
+// Knuth, The Art of Computer Programming, Vol 2, 4.3.1, Algorithm D, as in
+// Hacker's Delight (divmnu64). Digits are 64 bit limbs where a 128 bit integer
+// is available (quotient estimate by native 128/64 division), otherwise the
+// limbs are split into 32 bit digits with 64 bit intermediates.
+
+BC_PUSH_WARNING(NO_STATIC_CAST)
+
+constexpr void uint256::divide(uint256& quotient, uint256& remainder,
+    const uint256& dividend, const uint256& divisor) NOEXCEPT
+{
+    // Division by zero is undefined, zero is returned (caller must guard).
+    if (is_zero(divisor))
+    {
+        quotient = uint256{};
+        remainder = uint256{};
+        return;
+    }
+
+    if (dividend < divisor)
+    {
+        remainder = dividend;
+        quotient = uint256{};
+        return;
+    }
+
+    // Single limb divisor and dividend (common for small values).
+    const auto dividend_width = dividend.bit_width();
+    if (dividend_width <= bits / limbs)
+    {
+        remainder = uint256{ dividend.words_[0] % divisor.words_[0] };
+        quotient = uint256{ dividend.words_[0] / divisor.words_[0] };
+        return;
+    }
+
+#if defined(HAVE_INT128)
+    __extension__ using wide = unsigned __int128;
+    __extension__ using signed_wide = __int128;
+    constexpr auto width = bits / limbs;
+    const auto m = ceilinged_divide(dividend_width, width);
+    const auto n = ceilinged_divide(divisor.bit_width(), width);
+    knuth<limb, wide, signed_wide>(quotient.words_, remainder.words_,
+        dividend.words_, divisor.words_, m, n);
+#else
+    constexpr auto width = to_bits(sizeof(digit));
+    const auto m = ceilinged_divide(dividend_width, width);
+    const auto n = ceilinged_divide(divisor.bit_width(), width);
+    digits_type q{};
+    digits_type r{};
+    knuth<digit, uint64_t, int64_t>(q, r, to_digits(dividend),
+        to_digits(divisor), m, n);
+    quotient = from_digits(q);
+    remainder = from_digits(r);
+#endif
+}
+
+template <typename Digit, typename Wide, typename Signed, size_t Count>
+constexpr void uint256::knuth(std_array<Digit, Count>& q,
+    std_array<Digit, Count>& r, const std_array<Digit, Count>& u,
+    const std_array<Digit, Count>& v, size_t m, size_t n) NOEXCEPT
+{
+    constexpr auto width = to_bits(sizeof(Digit));
+    constexpr auto base = static_cast<Wide>(1) << width;
+    q = {};
+    r = {};
+
+    // Single digit divisor, short division.
+    if (is_one(n))
+    {
+        Digit carry{};
+        for (auto j = m; !is_zero(j); --j)
+            q[sub1(j)] = divide_digit<Digit, Wide>(carry, carry, u[sub1(j)],
+                v[0]);
+
+        r[0] = carry;
+        return;
+    }
+
+    // Normalize so that the divisor high digit has its high bit set.
+    const auto s = static_cast<size_t>(std::countl_zero(v[sub1(n)]));
+    const auto high = [&](Digit value) NOEXCEPT
+    {
+        return is_zero(s) ? Digit{} : static_cast<Digit>(value >> (width - s));
+    };
+
+    std_array<Digit, Count> vn{};
+    std_array<Digit, add1(Count)> un{};
+
+    for (auto i = sub1(n); !is_zero(i); --i)
+        vn[i] = static_cast<Digit>(v[i] << s) | high(v[sub1(i)]);
+
+    vn[0] = static_cast<Digit>(v[0] << s);
+    un[m] = high(u[sub1(m)]);
+    for (auto i = sub1(m); !is_zero(i); --i)
+        un[i] = static_cast<Digit>(u[i] << s) | high(u[sub1(i)]);
+
+    un[0] = static_cast<Digit>(u[0] << s);
+
+    for (auto j = add1(m - n); !is_zero(j); --j)
+    {
+        const auto k = sub1(j);
+
+        // Estimate quotient digit and correct by at most two.
+        Wide qhat{};
+        Wide rhat{};
+        if (un[k + n] >= vn[sub1(n)])
+        {
+            // Quotient digit would overflow, so start from the maximum.
+            qhat = sub1(base);
+            rhat = ((static_cast<Wide>(un[k + n]) << width) |
+                un[k + sub1(n)]) - qhat * vn[sub1(n)];
+        }
+        else
+        {
+            Digit remainder{};
+            qhat = divide_digit<Digit, Wide>(remainder, un[k + n],
+                un[k + sub1(n)], vn[sub1(n)]);
+            rhat = remainder;
+        }
+
+        while (rhat < base && (qhat >= base || qhat * vn[n - 2u] >
+            ((rhat << width) | un[k + n - 2u])))
+        {
+            --qhat;
+            rhat += vn[sub1(n)];
+        }
+
+        // Multiply and subtract.
+        Signed borrow{};
+        Signed t{};
+        for (size_t i = 0; i < n; ++i)
+        {
+            const auto product = qhat * vn[i];
+            t = static_cast<Signed>(un[i + k]) - borrow -
+                static_cast<Signed>(static_cast<Digit>(product));
+            un[i + k] = static_cast<Digit>(t);
+            borrow = static_cast<Signed>(product >> width) - (t >> width);
+        }
+
+        t = static_cast<Signed>(un[k + n]) - borrow;
+        un[k + n] = static_cast<Digit>(t);
+        q[k] = static_cast<Digit>(qhat);
+
+        // Subtracted too much, add back.
+        if (t < 0)
+        {
+            --q[k];
+            Wide carry{};
+            for (size_t i = 0; i < n; ++i)
+            {
+                const auto sum = static_cast<Wide>(un[i + k]) + vn[i] + carry;
+                un[i + k] = static_cast<Digit>(sum);
+                carry = sum >> width;
+            }
+
+            un[k + n] = static_cast<Digit>(un[k + n] + carry);
+        }
+    }
+
+    // Denormalize remainder.
+    for (size_t i = 0; i < n; ++i)
+        r[i] = static_cast<Digit>(un[i] >> s) | (is_zero(s) ? Digit{} :
+            static_cast<Digit>(static_cast<Wide>(un[add1(i)]) << (width - s)));
+}
+
+BC_POP_WARNING()
+
+// private
+// ----------------------------------------------------------------------------
+
+template <typename Digit, typename Wide>
+constexpr Digit uint256::divide_digit(Digit& remainder, Digit high, Digit low,
+    Digit divisor) NOEXCEPT
+{
+    // Quotient fits a digit (high < divisor), guarded by the caller.
+    BC_ASSERT(high < divisor);
+
+#if defined(HAVE_INT128) && defined(HAVE_X64)
+    if constexpr (is_same_type<Digit, limb>)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            // Native 128/64 division, avoiding the generic 128/128 call.
+            Digit quotient{};
+            __asm__("divq %[divisor]"
+                : "=a"(quotient), "=d"(remainder)
+                : [divisor] "r"(divisor), "a"(low), "d"(high));
+            return quotient;
+        }
+    }
+#endif
+
+    const auto numerator = (static_cast<Wide>(high) << to_bits(
+        sizeof(Digit))) | low;
+    const auto quotient = static_cast<Digit>(numerator / divisor);
+    remainder = static_cast<Digit>(numerator - static_cast<Wide>(quotient) *
+        divisor);
+    return quotient;
+}
+
+constexpr uint256::limb uint256::multiply(limb& high, limb left, limb right,
+    limb addend1, limb addend2) NOEXCEPT
+{
+    // left * right + addend1 + addend2 cannot overflow 128 bits.
+#if defined(HAVE_INT128)
+    __extension__ using uint128 = unsigned __int128;
+    const auto product = static_cast<uint128>(left) * right + addend1 +
+        addend2;
+    high = static_cast<limb>(product >> to_bits(sizeof(limb)));
+    return static_cast<limb>(product);
+#else
+    constexpr auto half = to_bits(sizeof(digit));
+    const auto left_lo = left & max_uint32;
+    const auto left_hi = left >> half;
+    const auto right_lo = right & max_uint32;
+    const auto right_hi = right >> half;
+
+    const auto lo_lo = left_lo * right_lo;
+    const auto hi_lo = left_hi * right_lo;
+    const auto lo_hi = left_lo * right_hi;
+    const auto hi_hi = left_hi * right_hi;
+
+    const auto cross = (lo_lo >> half) + (hi_lo & max_uint32) + lo_hi;
+    auto low = (cross << half) | (lo_lo & max_uint32);
+    high = hi_hi + (hi_lo >> half) + (cross >> half);
+
+    low += addend1;
+    high += to_int<limb>(low < addend1);
+    low += addend2;
+    high += to_int<limb>(low < addend2);
+    return low;
+#endif
+}
+
+constexpr uint256::digits_type uint256::to_digits(
+    const uint256& value) NOEXCEPT
+{
+    constexpr auto width = to_bits(sizeof(digit));
+    digits_type out{};
+    for (size_t index = 0; index < limbs; ++index)
+    {
+        out[index * 2u] = narrow_cast<digit>(value.words_[index]);
+        out[add1(index * 2u)] = narrow_cast<digit>(
+            value.words_[index] >> width);
+    }
+
+    return out;
+}
+
+constexpr uint256 uint256::from_digits(const digits_type& value) NOEXCEPT
+{
+    constexpr auto width = to_bits(sizeof(digit));
+    uint256 out{};
+    for (size_t index = 0; index < limbs; ++index)
+        out.words_[index] = shift_left(limb{ value[add1(index * 2u)] },
+            width) | value[index * 2u];
+
+    return out;
+}
+
+BC_POP_WARNING()
+
+// Free operators.
+// ----------------------------------------------------------------------------
+
+constexpr uint256 operator&(uint256 left, const uint256& right) NOEXCEPT
+{
+    return left &= right;
+}
+
+constexpr uint256 operator|(uint256 left, const uint256& right) NOEXCEPT
+{
+    return left |= right;
+}
+
+constexpr uint256 operator^(uint256 left, const uint256& right) NOEXCEPT
+{
+    return left ^= right;
+}
+
+constexpr uint256 operator<<(uint256 left, size_t shift) NOEXCEPT
+{
+    return left <<= shift;
+}
+
+constexpr uint256 operator>>(uint256 left, size_t shift) NOEXCEPT
+{
+    return left >>= shift;
+}
+
+constexpr uint256 operator+(uint256 left, const uint256& right) NOEXCEPT
+{
+    return left += right;
+}
+
+constexpr uint256 operator-(uint256 left, const uint256& right) NOEXCEPT
+{
+    return left -= right;
+}
+
+constexpr uint256 operator*(uint256 left, const uint256& right) NOEXCEPT
+{
+    return left *= right;
+}
+
+constexpr uint256 operator/(uint256 left, const uint256& right) NOEXCEPT
+{
+    return left /= right;
+}
+
+constexpr uint256 operator%(uint256 left, const uint256& right) NOEXCEPT
+{
+    return left %= right;
+}
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
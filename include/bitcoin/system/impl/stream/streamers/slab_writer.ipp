@@ -0,0 +1,172 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_STREAM_STREAMERS_SLAB_WRITER_IPP
+#define LIBBITCOIN_SYSTEM_STREAM_STREAMERS_SLAB_WRITER_IPP
+
+#include <algorithm>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+// Allowed here for low level performance benefit.
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+
+// constructors
+// ----------------------------------------------------------------------------
+
+slab_writer::slab_writer(const data_slab& sink) NOEXCEPT
+  : slab_writer(sink.data(), sink.size())
+{
+}
+
+slab_writer::slab_writer(uint8_t* begin, size_t size) NOEXCEPT
+  : position_(begin), begin_(begin), end_(std::next(begin, size))
+{
+}
+
+// little endian
+// ----------------------------------------------------------------------------
+
+template <typename Integer, size_t Size,
+    if_integer<Integer>, if_not_greater<Size, sizeof(Integer)>>
+void slab_writer::write_little_endian(Integer value) NOEXCEPT
+{
+    const auto bytes = byte_cast(native_to_little_end(value));
+    write_bytes(bytes.data(), Size);
+}
+
+void slab_writer::write_2_bytes_little_endian(uint16_t value) NOEXCEPT
+{
+    write_little_endian<uint16_t>(value);
+}
+
+void slab_writer::write_4_bytes_little_endian(uint32_t value) NOEXCEPT
+{
+    write_little_endian<uint32_t>(value);
+}
+
+void slab_writer::write_8_bytes_little_endian(uint64_t value) NOEXCEPT
+{
+    write_little_endian<uint64_t>(value);
+}
+
+void slab_writer::write_variable(uint64_t value) NOEXCEPT
+{
+    if (value < varint_two_bytes)
+    {
+        write_byte(narrow_cast<uint8_t>(value));
+    }
+    else if (value <= max_uint16)
+    {
+        write_byte(varint_two_bytes);
+        write_2_bytes_little_endian(narrow_cast<uint16_t>(value));
+    }
+    else if (value <= max_uint32)
+    {
+        write_byte(varint_four_bytes);
+        write_4_bytes_little_endian(narrow_cast<uint32_t>(value));
+    }
+    else
+    {
+        write_byte(varint_eight_bytes);
+        write_8_bytes_little_endian(value);
+    }
+}
+
+void slab_writer::write_byte(uint8_t value) NOEXCEPT
+{
+    if (is_overflow(one))
+        return;
+
+    *position_++ = value;
+}
+
+// bytes
+// ----------------------------------------------------------------------------
+
+void slab_writer::write_bytes(const data_slice& data) NOEXCEPT
+{
+    write_bytes(data.data(), data.size());
+}
+
+void slab_writer::write_bytes(const uint8_t* data, size_t size) NOEXCEPT
+{
+    if (is_overflow(size))
+        return;
+
+    // Bulk copy, data_slice may be empty (null data).
+    if (!is_zero(size))
+    {
+        BC_PUSH_WARNING(NO_UNSAFE_COPY_N)
+        std::copy_n(data, size, position_);
+        BC_POP_WARNING()
+        position_ += size;
+    }
+}
+
+// control
+// ----------------------------------------------------------------------------
+
+void slab_writer::flush() NOEXCEPT
+{
+}
+
+size_t slab_writer::get_write_position() const NOEXCEPT
+{
+    return is_null(position_) ? zero :
+        possible_narrow_sign_cast<size_t>(position_ - begin_);
+}
+
+slab_writer::operator bool() const NOEXCEPT
+{
+    return !is_null(position_);
+}
+
+bool slab_writer::operator!() const NOEXCEPT
+{
+    return is_null(position_);
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+bool slab_writer::is_overflow(size_t size) NOEXCEPT
+{
+    // Invalidation (null position) is sticky.
+    if (is_null(position_))
+        return true;
+
+    if (size <= possible_narrow_sign_cast<size_t>(end_ - position_))
+        return false;
+
+    // Overflow invalidates the writer.
+    position_ = nullptr;
+    return true;
+}
+
+BC_POP_WARNING()
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
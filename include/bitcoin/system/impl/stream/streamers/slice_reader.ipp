@@ -0,0 +1,341 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_STREAM_STREAMERS_SLICE_READER_IPP
+#define LIBBITCOIN_SYSTEM_STREAM_STREAMERS_SLICE_READER_IPP
+
+#include <algorithm>
+#include <iterator>
+#include <bitcoin/system/allocator.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+// Allowed here for low level performance benefit.
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+
+// Suppress allocator may throw inside NOEXCEPT.
+// The intended behavior in this case is program abort.
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+// static
+slice_reader::memory_arena slice_reader::default_arena() NOEXCEPT
+{
+    return bc::default_arena::get();
+}
+
+// constructors
+// ----------------------------------------------------------------------------
+
+slice_reader::slice_reader(const data_slice& source,
+    const memory_arena& arena) NOEXCEPT
+  : slice_reader(source.data(), source.size(), arena)
+{
+}
+
+slice_reader::slice_reader(const uint8_t* begin, size_t size,
+    const memory_arena& arena) NOEXCEPT
+  : begin_(begin),
+    position_(begin),
+    limit_(std::next(begin, size)),
+    end_(limit_),
+    valid_(true),
+    allocator_(arena)
+{
+}
+
+// little endian
+// ----------------------------------------------------------------------------
+
+template <typename Integer, size_t Size,
+    if_integer<Integer>, if_not_greater<Size, sizeof(Integer)>>
+Integer slice_reader::read_little_endian() NOEXCEPT
+{
+    // Full width is a single bounds check and unaligned load (and byteswap).
+    if constexpr (Size == sizeof(Integer))
+    {
+        const auto data = read_pointer(Size);
+        return is_null(data) ? Integer{} :
+            unsafe_from_little_endian<Integer>(data);
+    }
+    else
+    {
+        Integer value{};
+        auto& bytes = byte_cast(value);
+        read_bytes(bytes.data(), Size);
+        return native_from_little_end(value);
+    }
+}
+
+uint16_t slice_reader::read_2_bytes_little_endian() NOEXCEPT
+{
+    return read_little_endian<uint16_t>();
+}
+
+uint32_t slice_reader::read_4_bytes_little_endian() NOEXCEPT
+{
+    return read_little_endian<uint32_t>();
+}
+
+uint64_t slice_reader::read_8_bytes_little_endian() NOEXCEPT
+{
+    return read_little_endian<uint64_t>();
+}
+
+uint64_t slice_reader::read_variable() NOEXCEPT
+{
+    // Indexed by prefix less varint_two_bytes less one (zero if one byte).
+    constexpr std_array<uint8_t, 4> widths
+    {
+        sizeof(uint8_t),
+        sizeof(uint8_t) + sizeof(uint16_t),
+        sizeof(uint8_t) + sizeof(uint32_t),
+        sizeof(uint8_t) + sizeof(uint64_t)
+    };
+    constexpr std_array<uint64_t, 4> masks
+    {
+        0, max_uint16, max_uint32, max_uint64
+    };
+    constexpr std_array<uint8_t, 4> prefixes
+    {
+        max_uint8, 0, 0, 0
+    };
+
+    // When the widest encoding is available the value is loaded once and
+    // masked to its width, so the only branch is this bounds check.
+    if (valid_ && remaining() > sizeof(uint64_t))
+    {
+        const auto prefix = *position_;
+        const auto index = floored_subtract(prefix, sub1(varint_two_bytes));
+
+        const auto value = (unsafe_from_little_endian<uint64_t>(
+            std::next(position_)) & masks[index]) | (prefix & prefixes[index]);
+
+        position_ += widths[index];
+        return value;
+    }
+
+    switch (const auto value = read_byte())
+    {
+        case varint_eight_bytes:
+            return read_8_bytes_little_endian();
+        case varint_four_bytes:
+            return read_4_bytes_little_endian();
+        case varint_two_bytes:
+            return read_2_bytes_little_endian();
+        default:
+            return value;
+    }
+}
+
+size_t slice_reader::read_size(size_t limit) NOEXCEPT
+{
+    const auto size = read_variable();
+
+    // Return zero allows follow-on use before testing reader state.
+    if (size > limit)
+    {
+        invalidate();
+        return zero;
+    }
+
+    return possible_narrow_cast<size_t>(size);
+}
+
+uint8_t slice_reader::peek_byte() NOEXCEPT
+{
+    if (is_exhausted())
+    {
+        invalidate();
+        return 0x00;
+    }
+
+    return *position_;
+}
+
+uint8_t slice_reader::read_byte() NOEXCEPT
+{
+    if (is_underflow(one))
+        return 0x00;
+
+    return *position_++;
+}
+
+// bytes
+// ----------------------------------------------------------------------------
+
+data_chunk slice_reader::read_bytes(size_t size) NOEXCEPT
+{
+    // Underflow check precedes allocation.
+    if (is_zero(size) || is_underflow(size))
+        return {};
+
+    const auto data = position_;
+    position_ += size;
+    return { data, position_ };
+}
+
+void slice_reader::read_bytes(uint8_t* buffer, size_t size) NOEXCEPT
+{
+    if (is_underflow(size))
+        return;
+
+    BC_PUSH_WARNING(NO_UNSAFE_COPY_N)
+    std::copy_n(position_, size, buffer);
+    BC_POP_WARNING()
+    position_ += size;
+}
+
+data_chunk* slice_reader::read_bytes_raw() NOEXCEPT
+{
+    // Remaining bytes are known, so no counting pass is required.
+    return read_bytes_raw(remaining());
+}
+
+data_chunk* slice_reader::read_bytes_raw(size_t size) NOEXCEPT
+{
+    // Underflow check precedes allocation.
+    if (is_underflow(size))
+        return nullptr;
+
+    // std::uses_allocator_construction_args supplies allocator to vector.
+    const auto raw = allocator_.new_object<data_chunk>(position_,
+        std::next(position_, size));
+
+    if (raw == nullptr)
+    {
+        invalidate();
+        return raw;
+    }
+
+    position_ += size;
+    return raw;
+}
+
+const uint8_t* slice_reader::read_pointer(size_t size) NOEXCEPT
+{
+    if (is_underflow(size))
+        return nullptr;
+
+    const auto data = position_;
+    position_ += size;
+    return data;
+}
+
+// control
+// ----------------------------------------------------------------------------
+
+void slice_reader::skip_byte() NOEXCEPT
+{
+    skip_bytes(one);
+}
+
+void slice_reader::skip_bytes(size_t size) NOEXCEPT
+{
+    if (!is_underflow(size))
+        position_ += size;
+}
+
+bool slice_reader::is_exhausted() const NOEXCEPT
+{
+    return !valid_ || position_ >= limit_;
+}
+
+size_t slice_reader::get_read_position() const NOEXCEPT
+{
+    return possible_narrow_sign_cast<size_t>(position_ - begin_);
+}
+
+void slice_reader::set_position(size_t absolute) NOEXCEPT
+{
+    // Clear a presumed error state following a read overflow.
+    valid_ = true;
+
+    // Positioning beyond the limit invalidates (without moving).
+    if (absolute > possible_narrow_sign_cast<size_t>(limit_ - begin_))
+    {
+        invalidate();
+        return;
+    }
+
+    position_ = std::next(begin_, absolute);
+}
+
+void slice_reader::set_limit(size_t size) NOEXCEPT
+{
+    // A limit beyond the end is equivalent to no limit.
+    const auto available = possible_narrow_sign_cast<size_t>(end_ - position_);
+    limit_ = std::next(position_, std::min(size, available));
+}
+
+void slice_reader::invalidate() NOEXCEPT
+{
+    // Invalidation is sticky until set_position.
+    valid_ = false;
+}
+
+slice_reader::memory_arena slice_reader::get_arena() const NOEXCEPT
+{
+    return allocator_.resource();
+}
+
+byte_allocator& slice_reader::get_allocator() const NOEXCEPT
+{
+    return allocator_;
+}
+
+slice_reader::operator bool() const NOEXCEPT
+{
+    return valid_;
+}
+
+bool slice_reader::operator!() const NOEXCEPT
+{
+    return !valid_;
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+size_t slice_reader::remaining() const NOEXCEPT
+{
+    return position_ < limit_ ?
+        possible_narrow_sign_cast<size_t>(limit_ - position_) : zero;
+}
+
+bool slice_reader::is_underflow(size_t size) NOEXCEPT
+{
+    if (valid_ && size <= remaining())
+        return false;
+
+    // Underflow invalidates the reader (without moving).
+    invalidate();
+    return true;
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
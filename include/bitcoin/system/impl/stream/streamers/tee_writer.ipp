@@ -0,0 +1,191 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_STREAM_STREAMERS_TEE_WRITER_IPP
+#define LIBBITCOIN_SYSTEM_STREAM_STREAMERS_TEE_WRITER_IPP
+
+#include <iterator>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+// constructors
+// ----------------------------------------------------------------------------
+
+tee_writer::tee_writer(const data_slab& sink, bool witness) NOEXCEPT
+  : tee_writer(sink.data(), sink.size(), witness)
+{
+}
+
+tee_writer::tee_writer(uint8_t* begin, size_t size, bool witness) NOEXCEPT
+  : sink_(begin, size),
+    begin_(begin),
+    nominal_(),
+    witnessed_(),
+    witness_(witness),
+    segregated_(false)
+{
+}
+
+// little endian
+// ----------------------------------------------------------------------------
+// Encoding is delegated to the slab writer, and the bytes it wrote are hashed.
+
+template <typename Integer, size_t Size,
+    if_integer<Integer>, if_not_greater<Size, sizeof(Integer)>>
+void tee_writer::write_little_endian(Integer value) NOEXCEPT
+{
+    const auto start = get_write_position();
+    sink_.write_little_endian<Integer, Size>(value);
+    accumulate(start);
+}
+
+void tee_writer::write_2_bytes_little_endian(uint16_t value) NOEXCEPT
+{
+    const auto start = get_write_position();
+    sink_.write_2_bytes_little_endian(value);
+    accumulate(start);
+}
+
+void tee_writer::write_4_bytes_little_endian(uint32_t value) NOEXCEPT
+{
+    const auto start = get_write_position();
+    sink_.write_4_bytes_little_endian(value);
+    accumulate(start);
+}
+
+void tee_writer::write_8_bytes_little_endian(uint64_t value) NOEXCEPT
+{
+    const auto start = get_write_position();
+    sink_.write_8_bytes_little_endian(value);
+    accumulate(start);
+}
+
+void tee_writer::write_variable(uint64_t value) NOEXCEPT
+{
+    const auto start = get_write_position();
+    sink_.write_variable(value);
+    accumulate(start);
+}
+
+void tee_writer::write_byte(uint8_t value) NOEXCEPT
+{
+    const auto start = get_write_position();
+    sink_.write_byte(value);
+    accumulate(start);
+}
+
+// bytes
+// ----------------------------------------------------------------------------
+
+void tee_writer::write_bytes(const data_slice& data) NOEXCEPT
+{
+    write_bytes(data.data(), data.size());
+}
+
+void tee_writer::write_bytes(const uint8_t* data, size_t size) NOEXCEPT
+{
+    const auto start = get_write_position();
+    sink_.write_bytes(data, size);
+    accumulate(start);
+}
+
+// hashing
+// ----------------------------------------------------------------------------
+
+void tee_writer::begin_witness() NOEXCEPT
+{
+    segregated_ = true;
+}
+
+void tee_writer::end_witness() NOEXCEPT
+{
+    segregated_ = false;
+}
+
+// Finalizes a copy, so hashes may be obtained at any point without reset.
+hash_digest tee_writer::nominal_hash() const NOEXCEPT
+{
+    auto context = nominal_;
+    return context.double_flush();
+}
+
+hash_digest tee_writer::witness_hash() const NOEXCEPT
+{
+    if (!witness_)
+        return null_hash;
+
+    auto context = witnessed_;
+    return context.double_flush();
+}
+
+// control
+// ----------------------------------------------------------------------------
+
+void tee_writer::flush() NOEXCEPT
+{
+}
+
+size_t tee_writer::get_write_position() const NOEXCEPT
+{
+    return sink_.get_write_position();
+}
+
+tee_writer::operator bool() const NOEXCEPT
+{
+    return !!sink_;
+}
+
+bool tee_writer::operator!() const NOEXCEPT
+{
+    return !sink_;
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+void tee_writer::accumulate(size_t start) NOEXCEPT
+{
+    // Nothing is hashed once the writer is invalid (or for empty data).
+    if (!sink_)
+        return;
+
+    const auto size = get_write_position() - start;
+    if (is_zero(size))
+        return;
+
+    BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+    const auto data = std::next(begin_, start);
+    BC_POP_WARNING()
+
+    // Hash overflow requires (2^64-8)/8 bytes, not checked.
+    if (!segregated_)
+        nominal_.write(size, data);
+
+    if (witness_)
+        witnessed_.write(size, data);
+}
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
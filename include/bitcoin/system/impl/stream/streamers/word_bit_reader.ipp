@@ -0,0 +1,185 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_STREAM_STREAMERS_WORD_BIT_READER_IPP
+#define LIBBITCOIN_SYSTEM_STREAM_STREAMERS_WORD_BIT_READER_IPP
+
+#include <iterator>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+// Allowed here for low level performance benefit.
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+
+// constructors
+// ----------------------------------------------------------------------------
+
+word_bit_reader::word_bit_reader(const data_slice& source) NOEXCEPT
+  : word_bit_reader(source.data(), source.size())
+{
+}
+
+word_bit_reader::word_bit_reader(const uint8_t* begin, size_t size) NOEXCEPT
+  : position_(begin),
+    end_(std::next(begin, size)),
+    buffer_(0),
+    count_(0),
+    valid_(true)
+{
+}
+
+// bits
+// ----------------------------------------------------------------------------
+
+bool word_bit_reader::read_bit() NOEXCEPT
+{
+    return !is_zero(read_bits(one));
+}
+
+uint64_t word_bit_reader::read_bits(size_t bits) NOEXCEPT
+{
+    constexpr auto width = bc::bits<uint64_t>;
+    constexpr auto half = to_half(width);
+    bits = lesser(width, bits);
+
+    // A refill guarantees at least 56 bits, so wider reads are split.
+    if (bits > width - byte_bits)
+    {
+        const auto high = read_bits(bits - half);
+        return shift_left(high, half) | read_bits(half);
+    }
+
+    if (count_ < bits)
+        refill();
+
+    if (count_ < bits)
+    {
+        invalidate();
+        return 0;
+    }
+
+    // Extract bits in one shift, leaving the remainder left aligned.
+    const auto value = shift_right(buffer_, width - bits);
+    buffer_ = shift_left(buffer_, bits);
+    count_ -= bits;
+    return value;
+}
+
+uint64_t word_bit_reader::read_unary() NOEXCEPT
+{
+    uint64_t value = 0;
+
+    while (valid_)
+    {
+        if (is_zero(count_))
+        {
+            refill();
+            if (is_zero(count_))
+            {
+                invalidate();
+                break;
+            }
+        }
+
+        // Bits beyond count_ are zero, so ones cannot exceed count_.
+        const auto ones = left_ones(buffer_);
+        if (ones < count_)
+        {
+            // Consume the ones and the terminating zero.
+            buffer_ = shift_left(buffer_, add1(ones));
+            count_ -= add1(ones);
+            return value + ones;
+        }
+
+        // The run of ones continues beyond the buffer.
+        value += ones;
+        buffer_ = 0;
+        count_ = 0;
+    }
+
+    return 0;
+}
+
+// control
+// ----------------------------------------------------------------------------
+
+bool word_bit_reader::is_exhausted() const NOEXCEPT
+{
+    return !valid_ || (is_zero(count_) && position_ == end_);
+}
+
+word_bit_reader::operator bool() const NOEXCEPT
+{
+    return valid_;
+}
+
+bool word_bit_reader::operator!() const NOEXCEPT
+{
+    return !valid_;
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+void word_bit_reader::refill() NOEXCEPT
+{
+    constexpr auto width = bc::bits<uint64_t>;
+    constexpr auto size = sizeof(uint64_t);
+    if (!valid_)
+        return;
+
+    if (possible_narrow_sign_cast<size_t>(end_ - position_) >= size)
+    {
+        // Load a full word and consume the whole bytes that fit the buffer.
+        // Trailing bits of a partially-fitting byte are masked and reloaded.
+        const auto& bytes = unsafe_array_cast<uint8_t, size>(position_);
+        const auto fit = (sub1(width) - count_) / byte_bits;
+        buffer_ |= shift_right(from_big_endian(bytes), count_);
+        count_ += fit * byte_bits;
+        buffer_ = mask_right(buffer_, width - count_);
+        position_ += fit;
+        return;
+    }
+
+    // Load remaining bytes individually near the end.
+    while (count_ <= width - byte_bits && position_ != end_)
+    {
+        buffer_ |= shift_left<uint64_t>(*position_++, width - byte_bits -
+            count_);
+        count_ += byte_bits;
+    }
+}
+
+void word_bit_reader::invalidate() NOEXCEPT
+{
+    valid_ = false;
+    buffer_ = 0;
+    count_ = 0;
+}
+
+BC_POP_WARNING()
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
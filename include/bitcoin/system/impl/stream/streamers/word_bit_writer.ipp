@@ -0,0 +1,120 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_STREAM_STREAMERS_WORD_BIT_WRITER_IPP
+#define LIBBITCOIN_SYSTEM_STREAM_STREAMERS_WORD_BIT_WRITER_IPP
+
+#include <iterator>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+// Suppress vector insert may throw inside NOEXCEPT.
+// The intended behavior in this case is program abort.
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+// constructors
+// ----------------------------------------------------------------------------
+
+word_bit_writer::word_bit_writer(data_chunk& sink) NOEXCEPT
+  : sink_(sink), buffer_(0), count_(0)
+{
+}
+
+word_bit_writer::~word_bit_writer() NOEXCEPT
+{
+    flush();
+}
+
+// bits
+// ----------------------------------------------------------------------------
+
+void word_bit_writer::write_bit(bool value) NOEXCEPT
+{
+    write_bits(to_int<uint64_t>(value), one);
+}
+
+void word_bit_writer::write_bits(uint64_t value, size_t bits) NOEXCEPT
+{
+    constexpr auto width = bc::bits<uint64_t>;
+    bits = lesser(width, bits);
+    value = mask_left(value, width - bits);
+
+    const auto space = width - count_;
+    if (bits < space)
+    {
+        buffer_ |= shift_left(value, space - bits);
+        count_ += bits;
+        return;
+    }
+
+    // Fill and dump the word, then carry the remaining low order bits.
+    const auto carry = bits - space;
+    buffer_ |= shift_right(value, carry);
+    dump();
+    buffer_ = shift_left(value, width - carry);
+    count_ = carry;
+}
+
+void word_bit_writer::write_unary(uint64_t value) NOEXCEPT
+{
+    constexpr auto width = bc::bits<uint64_t>;
+
+    for (; value >= width; value -= width)
+        write_bits(max_uint64, width);
+
+    // value ones followed by a zero, at most 64 bits.
+    write_bits(shift_left(sub1(shift_left<uint64_t>(1, value))), add1(value));
+}
+
+// control
+// ----------------------------------------------------------------------------
+
+void word_bit_writer::flush() NOEXCEPT
+{
+    if (is_zero(count_))
+        return;
+
+    const auto bytes = to_big_endian(buffer_);
+    const auto size = ceilinged_divide(count_, byte_bits);
+    sink_.insert(sink_.end(), bytes.begin(), std::next(bytes.begin(), size));
+    buffer_ = 0;
+    count_ = 0;
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+void word_bit_writer::dump() NOEXCEPT
+{
+    const auto bytes = to_big_endian(buffer_);
+    sink_.insert(sink_.end(), bytes.begin(), bytes.end());
+    buffer_ = 0;
+    count_ = 0;
+}
+
+BC_POP_WARNING()
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
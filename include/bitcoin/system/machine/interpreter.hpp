@@ -23,26 +23,28 @@
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/error/error.hpp>
 #include <bitcoin/system/chain/chain.hpp>
+#include <bitcoin/system/machine/profiler.hpp>
 #include <bitcoin/system/machine/program.hpp>
+#include <bitcoin/system/machine/rules.hpp>
 
 namespace libbitcoin {
 namespace system {
 namespace machine {
 
 /// Class to isolate operation iteration, dispatch, and handlers from state.
-template <typename Stack>
+template <typename Stack, uint32_t Rules = rules::dynamic>
 class interpreter
-  : public program<Stack>
+  : public program<Stack, Rules>
 {
 public:
     DELETE_COPY_MOVE_DESTRUCT(interpreter);
 
-    using state = program<Stack>;
+    using state = program<Stack, Rules>;
     using op_iterator = typename state::op_iterator;
     using input_iterator = chain::input_cptrs::const_iterator;
 
     /// Use program constructors.
-    using program<Stack>::program;
+    using program<Stack, Rules>::program;
 
     /// Run the program.
     code run() NOEXCEPT;
@@ -52,8 +54,10 @@ public:
         const chain::transaction& tx, uint32_t index) NOEXCEPT;
 
     /// Connect tx.input[*].script to tx.input[*].prevout.script.
+    /// A verified script-path commitment of the input is not reverified.
     static code connect(const chain::context& state,
-        const chain::transaction& tx, const input_iterator& it) NOEXCEPT;
+        const chain::transaction& tx, const input_iterator& it,
+        const chain::taproot::commitment* verified=nullptr) NOEXCEPT;
 
 protected:
     using flags = chain::flags;
@@ -61,6 +65,28 @@ protected:
     using operation = chain::operation;
     using op_error_t = error::op_error_t;
 
+    /// Full evaluation of input script against prevout script.
+    static code connect_generic(const chain::context& state,
+        const chain::transaction& tx, const input_iterator& it,
+        const chain::taproot::commitment* verified=nullptr) NOEXCEPT;
+
+    /// Standard script handlers, false if not handled (ec unchanged).
+    /// When handled, ec is identical to that produced by connect_generic.
+    static bool connect_standard(code& ec, const chain::context& state,
+        const chain::transaction& tx, const input_iterator& it) NOEXCEPT;
+    static bool connect_key_hash(code& ec, const chain::context& state,
+        const chain::transaction& tx, const input_iterator& it) NOEXCEPT;
+    static bool connect_witness_key_hash(code& ec, const chain::context& state,
+        const chain::transaction& tx, const input_iterator& it) NOEXCEPT;
+    static bool connect_taproot_key(code& ec, const chain::context& state,
+        const chain::transaction& tx, const input_iterator& it) NOEXCEPT;
+
+#if defined(HAVE_PROFILE)
+    /// Standard script handlers with profiler recording (by template).
+    static bool profile_standard(code& ec, const chain::context& state,
+        const chain::transaction& tx, const input_iterator& it) NOEXCEPT;
+#endif
+
     /// Embedded script handler.
     static code connect_embedded(const chain::context& state,
         const chain::transaction& tx, const input_iterator& it,
@@ -69,11 +95,17 @@ protected:
     /// Witnessed script handler.
     static code connect_witness(const chain::context& state,
         const chain::transaction& tx, const input_iterator& it,
-        const chain::script& prevout, bool embedded) NOEXCEPT;
+        const chain::script& prevout, bool embedded,
+        const chain::taproot::commitment* verified) NOEXCEPT;
 
     /// Operation disatch.
     op_error_t run_op(const op_iterator& op) NOEXCEPT;
 
+#if defined(HAVE_PROFILE)
+    /// Operation dispatch with profiler recording (and tracing).
+    op_error_t profile_op(const op_iterator& op) NOEXCEPT;
+#endif
+
     /// Operation handlers.
     inline op_error_t op_unevaluated(opcode) const NOEXCEPT;
     inline op_error_t op_nop(opcode) const NOEXCEPT;
@@ -168,8 +200,8 @@ protected:
 } // namespace system
 } // namespace libbitcoin
 
-#define TEMPLATE template <typename Stack>
-#define CLASS interpreter<Stack>
+#define TEMPLATE template <typename Stack, uint32_t Rules>
+#define CLASS interpreter<Stack, Rules>
 
 #include <bitcoin/system/impl/machine/interpreter.ipp>
 #include <bitcoin/system/impl/machine/interpreter_connect.ipp>
@@ -24,7 +24,9 @@
 #include <bitcoin/system/machine/number_boolean.hpp>
 #include <bitcoin/system/machine/number_chunk.hpp>
 #include <bitcoin/system/machine/number_integer.hpp>
+#include <bitcoin/system/machine/profiler.hpp>
 #include <bitcoin/system/machine/program.hpp>
+#include <bitcoin/system/machine/rules.hpp>
 #include <bitcoin/system/machine/stack.hpp>
 
 #endif
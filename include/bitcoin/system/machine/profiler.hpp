@@ -0,0 +1,144 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_MACHINE_PROFILER_HPP
+#define LIBBITCOIN_SYSTEM_MACHINE_PROFILER_HPP
+
+#include <array>
+#include <atomic>
+#include <functional>
+#include <string>
+#include <bitcoin/system/chain/enums/opcode.hpp>
+#include <bitcoin/system/chain/operation.hpp>
+#include <bitcoin/system/define.hpp>
+
+#if defined(HAVE_PROFILE)
+
+namespace libbitcoin {
+namespace system {
+namespace machine {
+
+/// Script execution profile, shared by concurrently connected inputs.
+/// Exists only when compiled WITH_PROFILE (HAVE_PROFILE), otherwise script
+/// evaluation is unaffected. Assign to chain::context.profile to profile a
+/// block connect. Inputs evaluated by a standard script fast path do not
+/// dispatch operations, so these are recorded by template, not by opcode.
+class BC_API profiler
+{
+public:
+    DELETE_COPY_MOVE(profiler);
+
+    /// Invoked before each executed op, with primary stack depth.
+    using tracer = std::function<void(const chain::operation& op,
+        size_t depth)>;
+
+    enum class event { sighash, verify };
+
+    /// Standard script templates evaluated without operation dispatch.
+    enum class standard { key_hash, witness_key_hash, taproot_key };
+
+    /// Point-in-time copy of counters.
+    struct report
+    {
+        static constexpr size_t opcodes = add1<size_t>(max_uint8);
+        static constexpr size_t standards = add1<size_t>(
+            static_cast<size_t>(standard::taproot_key));
+
+        std::array<uint64_t, opcodes> counts{};
+        std::array<uint64_t, opcodes> cycles{};
+        std::array<uint64_t, standards> standard_counts{};
+        std::array<uint64_t, standards> standard_cycles{};
+        size_t max_depth{};
+        uint64_t sighashes{};
+        uint64_t sighash_cycles{};
+        uint64_t verifies{};
+        uint64_t verify_cycles{};
+
+        /// Rows of executed opcodes and standard inputs (name, count,
+        /// cycles) and totals.
+        std::string to_string() const NOEXCEPT;
+    };
+
+    /// Sets current() for the lifetime of the scope (one input connect).
+    class BC_API scope
+    {
+    public:
+        DELETE_COPY_MOVE(scope);
+        scope(profiler* instance) NOEXCEPT;
+        ~scope() NOEXCEPT;
+
+    private:
+        profiler* previous_;
+    };
+
+    /// Records the lifetime of the scope as event, if current() is set.
+    class BC_API timer
+    {
+    public:
+        DELETE_COPY_MOVE(timer);
+        timer(event type) NOEXCEPT;
+        ~timer() NOEXCEPT;
+
+    private:
+        profiler* profiler_;
+        event type_;
+        uint64_t start_;
+    };
+
+    /// Timestamp counter (rdtsc on x86/x64, otherwise steady clock ticks).
+    static uint64_t now() NOEXCEPT;
+
+    /// Profiler assigned to this thread's current connect, or nullptr.
+    static profiler* current() NOEXCEPT;
+
+    profiler() NOEXCEPT;
+    profiler(tracer&& trace) NOEXCEPT;
+
+    /// Recording (thread safe).
+    void op(chain::opcode code, uint64_t cycles) NOEXCEPT;
+    void input(standard type, uint64_t cycles) NOEXCEPT;
+    void depth(size_t depth) NOEXCEPT;
+    void record(event type, uint64_t cycles) NOEXCEPT;
+    void trace(const chain::operation& op, size_t depth) const NOEXCEPT;
+
+    /// Reporting (call reset between blocks for per block reports).
+    report snapshot() const NOEXCEPT;
+    void reset() NOEXCEPT;
+
+private:
+    using counter = std::atomic<uint64_t>;
+
+    const tracer tracer_;
+    std::array<counter, report::opcodes> counts_{};
+    std::array<counter, report::opcodes> cycles_{};
+    std::array<counter, report::standards> standard_counts_{};
+    std::array<counter, report::standards> standard_cycles_{};
+    std::atomic<size_t> max_depth_{};
+    counter sighashes_{};
+    counter sighash_cycles_{};
+    counter verifies_{};
+    counter verify_cycles_{};
+};
+
+} // namespace machine
+} // namespace system
+} // namespace libbitcoin
+
+#endif // HAVE_PROFILE
+
+#endif
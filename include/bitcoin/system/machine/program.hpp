@@ -25,6 +25,8 @@
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/machine/profiler.hpp>
+#include <bitcoin/system/machine/rules.hpp>
 #include <bitcoin/system/machine/stack.hpp>
 
 namespace libbitcoin {
@@ -33,7 +35,8 @@ namespace machine {
 
 /// A set of three stacks (primary, alternate, conditional) for script state.
 /// Primary stack is optimized by peekable, swappable, and eraseable elements.
-template <typename Stack>
+/// Rules other than rules::dynamic fix script rule evaluation at compile time.
+template <typename Stack, uint32_t Rules = rules::dynamic>
 class program
 {
 public:
@@ -177,8 +180,8 @@ protected:
     INLINE void set_subscript(const op_iterator& op) NOEXCEPT;
 
     /// Strip endorsement and op_codeseparator from returned subscript.
-    inline script::cptr subscript(const chunk_xptrs& endorsements) const NOEXCEPT;
-    INLINE script::cptr subscript(const chunk_xptr& endorsement) const NOEXCEPT;
+    inline script::cptr subscript(const chunk_xptrs& endorsements) NOEXCEPT;
+    INLINE script::cptr subscript(const chunk_xptr& endorsement) NOEXCEPT;
 
     /// Signature hashing.
     /// -----------------------------------------------------------------------
@@ -187,6 +190,22 @@ protected:
     INLINE bool signature_hash(hash_digest& out, const script& subscript,
         uint8_t sighash_flags) const NOEXCEPT;
 
+    /// Signature verification.
+    /// -----------------------------------------------------------------------
+    static INLINE bool verify_ecdsa(const data_slice& point,
+        const hash_digest& hash, const ec_signature& signature) NOEXCEPT;
+    static INLINE bool verify_schnorr(const data_chunk& x_point,
+        const hash_digest& hash, const ec_signature& signature) NOEXCEPT;
+
+    /// Recover the points against which a multisig signature verifies.
+    static INLINE bool recover_ecdsa(uncompressed_list& out,
+        const hash_digest& hash, const ec_signature& signature) NOEXCEPT;
+
+    /// Match point to recovered points, verified if not comparable.
+    static INLINE bool match_ecdsa(const data_chunk& point,
+        const uncompressed_list& candidates, const hash_digest& hash,
+        const ec_signature& signature) NOEXCEPT;
+
     /// Multisig signature hash caching.
     /// -----------------------------------------------------------------------
     INLINE void initialize_cache() NOEXCEPT;
@@ -204,13 +223,23 @@ private:
         uint8_t flags;
         hash_digest hash;
     };
+    struct subscript_cache
+    {
+        op_iterator offset;
+        data_stack endorsements;
+        script::cptr stripped;
+    };
 
     // Signing helpers.
     static inline bool is_schnorr_sighash(uint8_t sighash_flags) NOEXCEPT;
     static inline chain::strippers create_strip_ops(
         const chunk_xptrs& endorsements) NOEXCEPT;
-    static INLINE chain::strippers create_strip_ops(
+    static INLINE bool is_strip_op(const operation& op,
         const chunk_xptr& endorsement) NOEXCEPT;
+    inline bool is_stripped(const op_iterator& start,
+        const chunk_xptrs& endorsements) const NOEXCEPT;
+    inline const script::cptr& strip(const op_iterator& start,
+        const chunk_xptrs& endorsements) NOEXCEPT;
 
     // Stack helpers.
     INLINE void push_chunk(const chunk_xptr& datum) NOEXCEPT;
@@ -231,6 +260,7 @@ private:
 
     // Caches.
     multisig_cache cache_{};
+    subscript_cache stripped_{};
 
     // Stacks.
     primary_stack primary_;
@@ -247,8 +277,8 @@ private:
 } // namespace system
 } // namespace libbitcoin
 
-#define TEMPLATE template <typename Stack>
-#define CLASS program<Stack>
+#define TEMPLATE template <typename Stack, uint32_t Rules>
+#define CLASS program<Stack, Rules>
 
 #include <bitcoin/system/impl/machine/program.ipp>
 #include <bitcoin/system/impl/machine/program_construct.ipp>
@@ -0,0 +1,77 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_MACHINE_RULES_HPP
+#define LIBBITCOIN_SYSTEM_MACHINE_RULES_HPP
+
+#include <bitcoin/system/chain/chain.hpp>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace machine {
+
+/// Script rule sets for compile-time specialization of program/interpreter.
+/// A specialization fixes each script rule bit to its presence in the set,
+/// except bip342, which remains conditional on tapscript program version.
+namespace rules
+{
+    /// All script rules are evaluated from active flags (unspecialized).
+    constexpr uint32_t dynamic = chain::flags::all_rules;
+
+    /// Flags that affect script evaluation, the specialization domain.
+    constexpr uint32_t mask =
+        chain::flags::bip16_rule |
+        chain::flags::bip65_rule |
+        chain::flags::bip66_rule |
+        chain::flags::bip112_rule |
+        chain::flags::bip141_rule |
+        chain::flags::bip143_rule |
+        chain::flags::bip147_rule |
+        chain::flags::bip341_rule |
+        chain::flags::bip342_rule |
+        chain::flags::nops_rule |
+        chain::flags::cats_rule;
+
+    /// Script rules active from csv (bip112) to segwit activation.
+    constexpr uint32_t pre_segwit =
+        chain::flags::bip16_rule |
+        chain::flags::bip65_rule |
+        chain::flags::bip66_rule |
+        chain::flags::bip112_rule;
+
+    /// Script rules active from segwit to taproot activation.
+    constexpr uint32_t segwit = pre_segwit |
+        chain::flags::bip9_bit1_group;
+
+    /// Script rules active from taproot activation.
+    constexpr uint32_t taproot = segwit |
+        chain::flags::bip9_bit2_group;
+
+    /// True if the flags' script rules are exactly the given rule set.
+    constexpr bool is_epoch(uint32_t active_flags, uint32_t set) NOEXCEPT
+    {
+        return (active_flags & mask) == set;
+    }
+}
+
+} // namespace machine
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -39,6 +39,11 @@ typedef std::variant<bool, int64_t, chunk_xptr> stack_variant;
 typedef std::list<stack_variant> linked_stack;
 typedef std::vector<stack_variant> contiguous_stack;
 
+/// Standard scripts do not exceed the inline element count, so evaluation of
+/// these allocates no stack storage. Variants are trivial, so erase (roll) is
+/// a single memmove, which is cheaper than the linked stack's linear search.
+typedef inline_vector<stack_variant, 32> inline_stack;
+
 /// Alternate stack requires no stack<T> abstraction.
 typedef std::vector<stack_variant> alternate_stack;
 
@@ -94,7 +99,8 @@ private:
     inline bool peek_signed(Integer& value) const NOEXCEPT;
 
     static constexpr auto linked_ = is_same_type<Container, linked_stack>;
-    static constexpr auto vector_ = is_same_type<Container, contiguous_stack>;
+    static constexpr auto vector_ = is_same_type<Container, contiguous_stack> ||
+        is_same_type<Container, inline_stack>;
     static_assert(linked_ || vector_, "unsupported stack container");
 
     Container container_;
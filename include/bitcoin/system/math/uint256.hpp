@@ -0,0 +1,129 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_MATH_UINT256_HPP
+#define LIBBITCOIN_SYSTEM_MATH_UINT256_HPP
+
+#include <compare>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// Fixed-width 256 bit unsigned integer of four 64 bit limbs (low first).
+/// This is a constexpr alternative to uint256_t (boost multiprecision) for
+/// hot consensus paths (proof of work and cumulative work). Arithmetic is
+/// modulo 2^256 and division by zero produces zero (caller must guard).
+class uint256
+{
+public:
+    using limb = uint64_t;
+    static constexpr size_t limbs = 4;
+    static constexpr size_t bytes = limbs * sizeof(limb);
+    static constexpr size_t bits = to_bits(bytes);
+    using limbs_type = std_array<limb, limbs>;
+    using bytes_type = std_array<uint8_t, bytes>;
+
+    /// Construct.
+    constexpr uint256() NOEXCEPT;
+    constexpr uint256(limb value) NOEXCEPT;
+    constexpr explicit uint256(const limbs_type& value) NOEXCEPT;
+
+    /// Conversion from uint256_t, implicit for API compatibility.
+    uint256(const uint256_t& value) NOEXCEPT;
+
+    /// Conversion to uint256_t.
+    explicit operator uint256_t() const NOEXCEPT;
+
+    /// Little-endian byte conversions (same as to_uintx/from_uintx).
+    static constexpr uint256 from_little_endian(
+        const bytes_type& data) NOEXCEPT;
+    constexpr bytes_type to_little_endian() const NOEXCEPT;
+
+    /// Properties.
+    constexpr const limbs_type& words() const NOEXCEPT;
+    constexpr limb low() const NOEXCEPT;
+    constexpr size_t bit_width() const NOEXCEPT;
+
+    /// Comparison.
+    constexpr bool operator==(const uint256& other) const NOEXCEPT;
+    constexpr std::strong_ordering operator<=>(
+        const uint256& other) const NOEXCEPT;
+
+    /// Bitwise.
+    constexpr uint256 operator~() const NOEXCEPT;
+    constexpr uint256& operator&=(const uint256& other) NOEXCEPT;
+    constexpr uint256& operator|=(const uint256& other) NOEXCEPT;
+    constexpr uint256& operator^=(const uint256& other) NOEXCEPT;
+    constexpr uint256& operator<<=(size_t shift) NOEXCEPT;
+    constexpr uint256& operator>>=(size_t shift) NOEXCEPT;
+
+    /// Arithmetic (modulo 2^256).
+    constexpr uint256& operator++() NOEXCEPT;
+    constexpr uint256& operator--() NOEXCEPT;
+    constexpr uint256 operator++(int) NOEXCEPT;
+    constexpr uint256 operator--(int) NOEXCEPT;
+    constexpr uint256& operator+=(const uint256& other) NOEXCEPT;
+    constexpr uint256& operator-=(const uint256& other) NOEXCEPT;
+    constexpr uint256& operator*=(const uint256& other) NOEXCEPT;
+    constexpr uint256& operator/=(const uint256& other) NOEXCEPT;
+    constexpr uint256& operator%=(const uint256& other) NOEXCEPT;
+
+    /// Quotient and remainder in one pass (Knuth algorithm D).
+    static constexpr void divide(uint256& quotient, uint256& remainder,
+        const uint256& dividend, const uint256& divisor) NOEXCEPT;
+
+private:
+    using digit = uint32_t;
+    static constexpr size_t digits = bytes / sizeof(digit);
+    using digits_type = std_array<digit, digits>;
+
+    template <typename Digit, typename Wide, typename Signed, size_t Count>
+    static constexpr void knuth(std_array<Digit, Count>& quotient,
+        std_array<Digit, Count>& remainder,
+        const std_array<Digit, Count>& dividend,
+        const std_array<Digit, Count>& divisor, size_t dividend_digits,
+        size_t divisor_digits) NOEXCEPT;
+    template <typename Digit, typename Wide>
+    static constexpr Digit divide_digit(Digit& remainder, Digit high,
+        Digit low, Digit divisor) NOEXCEPT;
+    static constexpr limb multiply(limb& high, limb left, limb right,
+        limb addend1, limb addend2) NOEXCEPT;
+    static constexpr digits_type to_digits(const uint256& value) NOEXCEPT;
+    static constexpr uint256 from_digits(const digits_type& value) NOEXCEPT;
+
+    limbs_type words_;
+};
+
+constexpr uint256 operator&(uint256 left, const uint256& right) NOEXCEPT;
+constexpr uint256 operator|(uint256 left, const uint256& right) NOEXCEPT;
+constexpr uint256 operator^(uint256 left, const uint256& right) NOEXCEPT;
+constexpr uint256 operator<<(uint256 left, size_t shift) NOEXCEPT;
+constexpr uint256 operator>>(uint256 left, size_t shift) NOEXCEPT;
+constexpr uint256 operator+(uint256 left, const uint256& right) NOEXCEPT;
+constexpr uint256 operator-(uint256 left, const uint256& right) NOEXCEPT;
+constexpr uint256 operator*(uint256 left, const uint256& right) NOEXCEPT;
+constexpr uint256 operator/(uint256 left, const uint256& right) NOEXCEPT;
+constexpr uint256 operator%(uint256 left, const uint256& right) NOEXCEPT;
+
+} // namespace system
+} // namespace libbitcoin
+
+#include <bitcoin/system/impl/math/uint256.ipp>
+
+#endif
@@ -49,6 +49,11 @@ public:
     virtual chain::checkpoints sorted_checkpoints() const NOEXCEPT;
     virtual chain::checkpoint top_checkpoint() const NOEXCEPT;
 
+    /// True if height is at/below the milestone (assume valid) height.
+    /// Script execution may be bypassed for such a block only when the caller
+    /// has established that it is an ancestor of the milestone block.
+    virtual bool is_under_milestone(size_t height) const NOEXCEPT;
+
     /// These are used by chain_state (only).
     virtual uint32_t minimum_timespan() const NOEXCEPT;
     virtual uint32_t maximum_timespan() const NOEXCEPT;
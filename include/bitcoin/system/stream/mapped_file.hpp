@@ -0,0 +1,72 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_STREAM_MAPPED_FILE_HPP
+#define LIBBITCOIN_SYSTEM_STREAM_MAPPED_FILE_HPP
+
+#include <filesystem>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// Read-only memory map of an entire file (e.g. a bootstrap or blk*.dat file).
+/// data() is a data_reference over the mapping, so it may be read in place by
+/// stream::in::fast, read::bytes::slice and chain constructors, without first
+/// copying the file into a data_chunk. All such references are invalidated
+/// when the mapping is released (by destruct or move assignment).
+class BC_API mapped_file
+{
+public:
+    DELETE_COPY(mapped_file);
+
+    /// An empty file or a failure to open/map results in an invalid object.
+    /// Sequential advises aggressive readahead, otherwise random access.
+    mapped_file(const std::filesystem::path& path,
+        bool sequential=true) NOEXCEPT;
+    mapped_file(mapped_file&& other) NOEXCEPT;
+    mapped_file& operator=(mapped_file&& other) NOEXCEPT;
+    ~mapped_file() NOEXCEPT;
+
+    /// Advise that a range will soon be read (asynchronous readahead).
+    bool prefetch(size_t offset, size_t size) const NOEXCEPT;
+
+    /// Advise that a range has been read and its pages may be reclaimed.
+    bool evict(size_t offset, size_t size) const NOEXCEPT;
+
+    /// The mapped file contents.
+    data_reference data() const NOEXCEPT;
+    size_t size() const NOEXCEPT;
+
+    /// True if mapped.
+    operator bool() const NOEXCEPT;
+    bool operator!() const NOEXCEPT;
+
+private:
+    bool advise(size_t offset, size_t size, bool needed) const NOEXCEPT;
+    void unmap() NOEXCEPT;
+
+    uint8_t* data_;
+    size_t size_;
+};
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
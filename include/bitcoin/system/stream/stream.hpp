@@ -27,6 +27,7 @@
 #include <bitcoin/system/stream/devices/push_sink.hpp>
 #include <bitcoin/system/stream/make_stream.hpp>
 #include <bitcoin/system/stream/make_streamer.hpp>
+#include <bitcoin/system/stream/mapped_file.hpp>
 #include <bitcoin/system/stream/iostream/iostream.hpp>
 #include <bitcoin/system/stream/iostream/istream.hpp>
 #include <bitcoin/system/stream/iostream/ostream.hpp>
@@ -43,6 +44,11 @@
 #include <bitcoin/system/stream/streamers/interfaces/bitwriter.hpp>
 #include <bitcoin/system/stream/streamers/interfaces/bytewriter.hpp>
 #include <bitcoin/system/stream/streamers/sha256_writer.hpp>
+#include <bitcoin/system/stream/streamers/slab_writer.hpp>
+#include <bitcoin/system/stream/streamers/slice_reader.hpp>
+#include <bitcoin/system/stream/streamers/tee_writer.hpp>
+#include <bitcoin/system/stream/streamers/word_bit_reader.hpp>
+#include <bitcoin/system/stream/streamers/word_bit_writer.hpp>
 #include <bitcoin/system/stream/streamers.hpp>
 #include <bitcoin/system/stream/streams.hpp>
 #include <bitcoin/system/stream/stream_result.hpp>
@@ -45,6 +45,11 @@
 #include <bitcoin/system/stream/streamers/sha256_writer.hpp>
 #include <bitcoin/system/stream/streamers/sha256t_writer.hpp>
 #include <bitcoin/system/stream/streamers/sha256x2_writer.hpp>
+#include <bitcoin/system/stream/streamers/slab_writer.hpp>
+#include <bitcoin/system/stream/streamers/slice_reader.hpp>
+#include <bitcoin/system/stream/streamers/tee_writer.hpp>
+#include <bitcoin/system/stream/streamers/word_bit_reader.hpp>
+#include <bitcoin/system/stream/streamers/word_bit_writer.hpp>
 
 // Stream Exceptions:
 // ============================================================================
@@ -77,6 +82,9 @@ namespace read
 
         /// A byte reader that copies from a data_reference via std::istream.
         using copy = make_streamer<copy_source<data_reference>, byte_reader>;
+
+        /// A final (non-virtual) byte reader that reads from a data_slice.
+        using slice = slice_reader;
     }
 
     namespace bits
@@ -89,6 +97,9 @@ namespace read
 
         /// A bit reader that copies from a data_reference via std::istream.
         using copy = make_streamer<copy_source<data_reference>, bit_reader>;
+
+        /// A final (non-virtual) word-buffered bit reader of a data_slice.
+        using word = word_bit_reader;
     }
 }
 
@@ -105,6 +116,12 @@ namespace write
         /// A byte writer that copies to a data_slab via std::ostream.
         using copy = make_streamer<copy_sink<data_slab>, byte_writer>;
 
+        /// A final (non-virtual) byte writer that copies to a data_slab.
+        using slab = slab_writer;
+
+        /// A final byte writer that copies to a data_slab and bitcoin hashes.
+        using tee = tee_writer;
+
         /// A byte writer that inserts into a container via std::ostream.
         template <typename Container>
         using push = make_streamer<push_sink<Container>, byte_writer>;
@@ -123,6 +140,9 @@ namespace write
         /// A bit writer that copies to a data_slab.
         using copy = make_streamer<copy_sink<data_slab>, bit_writer>;
 
+        /// A final (non-virtual) word-buffered bit writer to a data_chunk.
+        using word = word_bit_writer;
+
         /// A bit writer that inserts into a container via std::ostream.
         template <typename Container>
         using push = make_streamer<push_sink<Container>, bit_writer>;
@@ -40,6 +40,9 @@ public:
     /// Flush on destruct.
     ~sha256t_writer() NOEXCEPT override;
 
+    /// Hash state following the (one block) tag prefix [bip340].
+    static constexpr sha256::state_t midstate() NOEXCEPT;
+
 protected:
     /// The maximum addressable stream position.
     static constexpr size_t maximum = hash_size;
@@ -48,8 +51,6 @@ protected:
     void do_flush() NOEXCEPT override;
 
 private:
-    static constexpr sha256::state_t midstate() NOEXCEPT;
-
     void flusher() NOEXCEPT;
 
     accumulator<sha256> context_;
@@ -0,0 +1,98 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_STREAM_STREAMERS_SLAB_WRITER_HPP
+#define LIBBITCOIN_SYSTEM_STREAM_STREAMERS_SLAB_WRITER_HPP
+
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// A final (non-virtual) byte writer that copies directly to a data_slab.
+/// This implements the subset of bytewriter required for chain serialization,
+/// for use where the buffer is presized (e.g. from cached serialized_size).
+/// Writing beyond the end of the slab invalidates the writer (no write).
+class slab_writer final
+{
+public:
+    DEFAULT_COPY_MOVE_DESTRUCT(slab_writer);
+
+    /// Constructors.
+    inline slab_writer(const data_slab& sink) NOEXCEPT;
+    inline slab_writer(uint8_t* begin, size_t size) NOEXCEPT;
+
+    /// Integrals.
+    /// -----------------------------------------------------------------------
+
+    /// Type-inferenced integer writer.
+    template <typename Integer, size_t Size = sizeof(Integer),
+        if_integer<Integer> = true,
+        if_not_greater<Size, sizeof(Integer)> = true>
+    inline void write_little_endian(Integer value) NOEXCEPT;
+
+    /// Write little endian integers.
+    inline void write_2_bytes_little_endian(uint16_t value) NOEXCEPT;
+    inline void write_4_bytes_little_endian(uint32_t value) NOEXCEPT;
+    inline void write_8_bytes_little_endian(uint64_t value) NOEXCEPT;
+
+    /// Write Bitcoin variable integer (1, 3, 5, or 9 bytes, little-endian).
+    inline void write_variable(uint64_t value) NOEXCEPT;
+
+    /// Write one byte.
+    inline void write_byte(uint8_t value) NOEXCEPT;
+
+    /// Buffers.
+    /// -----------------------------------------------------------------------
+
+    /// Write all bytes.
+    inline void write_bytes(const data_slice& data) NOEXCEPT;
+
+    /// Write size bytes.
+    inline void write_bytes(const uint8_t* data, size_t size) NOEXCEPT;
+
+    /// Control.
+    /// -----------------------------------------------------------------------
+
+    /// Flush the buffer (no-op).
+    inline void flush() NOEXCEPT;
+
+    /// Get the current absolute position.
+    inline size_t get_write_position() const NOEXCEPT;
+
+    /// The writer is valid.
+    inline operator bool() const NOEXCEPT;
+
+    /// The writer is invalid.
+    inline bool operator!() const NOEXCEPT;
+
+private:
+    inline bool is_overflow(size_t size) NOEXCEPT;
+
+    uint8_t* position_;
+    uint8_t* begin_;
+    uint8_t* end_;
+};
+
+} // namespace system
+} // namespace libbitcoin
+
+#include <bitcoin/system/impl/stream/streamers/slab_writer.ipp>
+
+#endif
@@ -0,0 +1,141 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_STREAM_STREAMERS_SLICE_READER_HPP
+#define LIBBITCOIN_SYSTEM_STREAM_STREAMERS_SLICE_READER_HPP
+
+#include <bitcoin/system/allocator.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// A final (non-virtual) byte reader that reads directly from a data_slice.
+/// This implements the subset of bytereader required for chain
+/// deserialization, allowing reads to inline into chain object construction.
+/// Reading beyond the end (or limit) invalidates the reader (zero returned).
+class slice_reader final
+{
+public:
+    DEFAULT_COPY_MOVE_DESTRUCT(slice_reader);
+    using memory_arena = arena*;
+    static inline memory_arena default_arena() NOEXCEPT;
+
+    /// Constructors.
+    inline slice_reader(const data_slice& source,
+        const memory_arena& arena=default_arena()) NOEXCEPT;
+    inline slice_reader(const uint8_t* begin, size_t size,
+        const memory_arena& arena=default_arena()) NOEXCEPT;
+
+    /// Integrals.
+    /// -----------------------------------------------------------------------
+
+    /// Type-inferenced integer reader.
+    template <typename Integer, size_t Size = sizeof(Integer),
+        if_integer<Integer> = true,
+        if_not_greater<Size, sizeof(Integer)> = true>
+    inline Integer read_little_endian() NOEXCEPT;
+
+    /// Read little endian integers.
+    inline uint16_t read_2_bytes_little_endian() NOEXCEPT;
+    inline uint32_t read_4_bytes_little_endian() NOEXCEPT;
+    inline uint64_t read_8_bytes_little_endian() NOEXCEPT;
+
+    /// Read Bitcoin variable integer (1, 3, 5, or 9 bytes, little-endian).
+    inline uint64_t read_variable() NOEXCEPT;
+
+    /// Cast read_variable to size_t, facilitates read_bytes(read_size()).
+    /// Returns zero and invalidates reader if would exceed read limit.
+    inline size_t read_size(size_t limit=max_size_t) NOEXCEPT;
+
+    /// Read/peek one byte (invalidates and returns zero if exhausted).
+    inline uint8_t peek_byte() NOEXCEPT;
+    inline uint8_t read_byte() NOEXCEPT;
+
+    /// Buffers.
+    /// -----------------------------------------------------------------------
+
+    /// Read size bytes, return size bytes by value (empty if invalid).
+    inline data_chunk read_bytes(size_t size) NOEXCEPT;
+
+    /// Read size bytes to buffer (buffer is unchanged if invalid).
+    inline void read_bytes(uint8_t* buffer, size_t size) NOEXCEPT;
+
+    /// Read size bytes (or all remaining) to an allocated chunk.
+    /// Returns nullptr if the read is invalid (or if reader is invalid).
+    inline data_chunk* read_bytes_raw() NOEXCEPT;
+    inline data_chunk* read_bytes_raw(size_t size) NOEXCEPT;
+
+    /// Advance over size bytes in a single bounds check and return a pointer
+    /// to them. Returns nullptr if the read is invalid (or reader is invalid).
+    /// This allows fixed-size structures to be parsed in place.
+    inline const uint8_t* read_pointer(size_t size) NOEXCEPT;
+
+    /// Control.
+    /// -----------------------------------------------------------------------
+
+    /// Advance the iterator.
+    inline void skip_byte() NOEXCEPT;
+    inline void skip_bytes(size_t size) NOEXCEPT;
+
+    /// The reader is empty (or invalid).
+    inline bool is_exhausted() const NOEXCEPT;
+
+    /// Get the current absolute position.
+    inline size_t get_read_position() const NOEXCEPT;
+
+    /// Clear invalid state and set absolute position.
+    inline void set_position(size_t absolute) NOEXCEPT;
+
+    /// Limit upper bound to current position plus size (default resets).
+    inline void set_limit(size_t size=max_size_t) NOEXCEPT;
+
+    /// Invalidate the reader.
+    inline void invalidate() NOEXCEPT;
+
+    /// Memory resource used to populate vectors.
+    inline memory_arena get_arena() const NOEXCEPT;
+
+    /// Memory allocator used to construct objects.
+    inline byte_allocator& get_allocator() const NOEXCEPT;
+
+    /// The reader is valid.
+    inline operator bool() const NOEXCEPT;
+
+    /// The reader is invalid.
+    inline bool operator!() const NOEXCEPT;
+
+private:
+    inline size_t remaining() const NOEXCEPT;
+    inline bool is_underflow(size_t size) NOEXCEPT;
+
+    const uint8_t* begin_;
+    const uint8_t* position_;
+    const uint8_t* limit_;
+    const uint8_t* end_;
+    bool valid_;
+    mutable byte_allocator allocator_;
+};
+
+} // namespace system
+} // namespace libbitcoin
+
+#include <bitcoin/system/impl/stream/streamers/slice_reader.ipp>
+
+#endif
@@ -0,0 +1,120 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_STREAM_STREAMERS_TEE_WRITER_HPP
+#define LIBBITCOIN_SYSTEM_STREAM_STREAMERS_TEE_WRITER_HPP
+
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/stream/streamers/slab_writer.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// A final (non-virtual) byte writer that copies to a data_slab while also
+/// accumulating bitcoin (sha256x2) hashes of the written bytes, so that one
+/// serialization pass yields the bytes, the nominal hash and the witness hash.
+/// Bytes written between begin_witness() and end_witness() are excluded from
+/// the nominal hash. The witness hash is accumulated only if enabled.
+/// Writing beyond the end of the slab invalidates the writer (no write).
+class tee_writer final
+{
+public:
+    DEFAULT_COPY_MOVE_DESTRUCT(tee_writer);
+
+    /// Constructors.
+    inline tee_writer(const data_slab& sink, bool witness) NOEXCEPT;
+    inline tee_writer(uint8_t* begin, size_t size, bool witness) NOEXCEPT;
+
+    /// Integrals.
+    /// -----------------------------------------------------------------------
+
+    /// Type-inferenced integer writer.
+    template <typename Integer, size_t Size = sizeof(Integer),
+        if_integer<Integer> = true,
+        if_not_greater<Size, sizeof(Integer)> = true>
+    inline void write_little_endian(Integer value) NOEXCEPT;
+
+    /// Write little endian integers.
+    inline void write_2_bytes_little_endian(uint16_t value) NOEXCEPT;
+    inline void write_4_bytes_little_endian(uint32_t value) NOEXCEPT;
+    inline void write_8_bytes_little_endian(uint64_t value) NOEXCEPT;
+
+    /// Write Bitcoin variable integer (1, 3, 5, or 9 bytes, little-endian).
+    inline void write_variable(uint64_t value) NOEXCEPT;
+
+    /// Write one byte.
+    inline void write_byte(uint8_t value) NOEXCEPT;
+
+    /// Buffers.
+    /// -----------------------------------------------------------------------
+
+    /// Write all bytes.
+    inline void write_bytes(const data_slice& data) NOEXCEPT;
+
+    /// Write size bytes.
+    inline void write_bytes(const uint8_t* data, size_t size) NOEXCEPT;
+
+    /// Hashing.
+    /// -----------------------------------------------------------------------
+
+    /// Exclude subsequent bytes from the nominal hash.
+    inline void begin_witness() NOEXCEPT;
+
+    /// Include subsequent bytes in the nominal hash.
+    inline void end_witness() NOEXCEPT;
+
+    /// Bitcoin hash of bytes written outside of witness sections.
+    inline hash_digest nominal_hash() const NOEXCEPT;
+
+    /// Bitcoin hash of all bytes written (null_hash if not enabled).
+    inline hash_digest witness_hash() const NOEXCEPT;
+
+    /// Control.
+    /// -----------------------------------------------------------------------
+
+    /// Flush the buffer (no-op).
+    inline void flush() NOEXCEPT;
+
+    /// Get the current absolute position.
+    inline size_t get_write_position() const NOEXCEPT;
+
+    /// The writer is valid.
+    inline operator bool() const NOEXCEPT;
+
+    /// The writer is invalid.
+    inline bool operator!() const NOEXCEPT;
+
+private:
+    inline void accumulate(size_t start) NOEXCEPT;
+
+    slab_writer sink_;
+    uint8_t* begin_;
+    accumulator<sha256> nominal_;
+    accumulator<sha256> witnessed_;
+    bool witness_;
+    bool segregated_;
+};
+
+} // namespace system
+} // namespace libbitcoin
+
+#include <bitcoin/system/impl/stream/streamers/tee_writer.ipp>
+
+#endif
@@ -0,0 +1,76 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_STREAM_STREAMERS_WORD_BIT_READER_HPP
+#define LIBBITCOIN_SYSTEM_STREAM_STREAMERS_WORD_BIT_READER_HPP
+
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// A final (non-virtual) bit reader that reads from a data_slice.
+/// Bits are read high-order first (as bit_reader), buffered by 64 bit word.
+/// This implements the subset of bitreader required for Golomb-Rice decoding.
+/// Reading beyond the end invalidates the reader (zero returned).
+class word_bit_reader final
+{
+public:
+    DEFAULT_COPY_MOVE_DESTRUCT(word_bit_reader);
+
+    /// Constructors.
+    inline word_bit_reader(const data_slice& source) NOEXCEPT;
+    inline word_bit_reader(const uint8_t* begin, size_t size) NOEXCEPT;
+
+    /// Read one bit (high order first).
+    inline bool read_bit() NOEXCEPT;
+
+    /// Read bits into the low order bits of the result (limited to 64).
+    inline uint64_t read_bits(size_t bits) NOEXCEPT;
+
+    /// Read a unary value, the count of one bits terminated by a zero bit.
+    inline uint64_t read_unary() NOEXCEPT;
+
+    /// The reader is empty (or invalid), padding bits are not exhausted.
+    inline bool is_exhausted() const NOEXCEPT;
+
+    /// The reader is valid.
+    inline operator bool() const NOEXCEPT;
+
+    /// The reader is invalid.
+    inline bool operator!() const NOEXCEPT;
+
+private:
+    inline void refill() NOEXCEPT;
+    inline void invalidate() NOEXCEPT;
+
+    // Unread bits are left aligned in buffer_, all others are zero.
+    const uint8_t* position_;
+    const uint8_t* end_;
+    uint64_t buffer_;
+    size_t count_;
+    bool valid_;
+};
+
+} // namespace system
+} // namespace libbitcoin
+
+#include <bitcoin/system/impl/stream/streamers/word_bit_reader.ipp>
+
+#endif
@@ -0,0 +1,67 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_STREAM_STREAMERS_WORD_BIT_WRITER_HPP
+#define LIBBITCOIN_SYSTEM_STREAM_STREAMERS_WORD_BIT_WRITER_HPP
+
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// A final (non-virtual) bit writer that appends to a data_chunk.
+/// Bits are written high-order first (as bit_writer), buffered by 64 bit word.
+/// This implements the subset of bitwriter required for Golomb-Rice encoding.
+/// Partial bytes are zero-padded on flush, which occurs on destruct.
+class word_bit_writer final
+{
+public:
+    DELETE_COPY_MOVE(word_bit_writer);
+
+    /// Constructors.
+    inline word_bit_writer(data_chunk& sink) NOEXCEPT;
+    inline ~word_bit_writer() NOEXCEPT;
+
+    /// Write one bit (high order first).
+    inline void write_bit(bool value) NOEXCEPT;
+
+    /// Write the low order bits of value (limited to 64).
+    inline void write_bits(uint64_t value, size_t bits) NOEXCEPT;
+
+    /// Write a unary value, as value one bits terminated by a zero bit.
+    inline void write_unary(uint64_t value) NOEXCEPT;
+
+    /// Write buffered bits to the sink (zero-padded to byte boundary).
+    inline void flush() NOEXCEPT;
+
+private:
+    inline void dump() NOEXCEPT;
+
+    // Unwritten bits are left aligned in buffer_, all others are zero.
+    data_chunk& sink_;
+    uint64_t buffer_;
+    size_t count_;
+};
+
+} // namespace system
+} // namespace libbitcoin
+
+#include <bitcoin/system/impl/stream/streamers/word_bit_writer.ipp>
+
+#endif
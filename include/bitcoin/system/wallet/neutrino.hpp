@@ -23,6 +23,7 @@
 #define LIBBITCOIN_SYSTEM_WALLET_NEUTRINO_HPP
 
 #include <memory>
+#include <vector>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/chain/chain.hpp>
@@ -38,15 +39,33 @@ struct BC_API block_filter
     data_chunk filter;
 };
 
+typedef std::vector<block_filter> block_filters;
+typedef std::vector<size_t> heights;
+
 BC_API bool compute_filter(data_chunk& out,
     const chain::block& block) NOEXCEPT;
 
+/// Compute filters for many blocks across the thread pool (e.g. backfill).
+/// Filters are in block order, false if any block lacks prevouts (its filter
+/// is then empty).
+BC_API bool compute_filters(data_stack& out,
+    const chain::blocks& blocks) NOEXCEPT;
+
 BC_API hash_digest compute_header(const hash_digest& previous_header,
     const data_chunk& filter) NOEXCEPT;
 
 BC_API hash_digest compute_header(hash_digest& filter_hash,
     const hash_digest& previous_header, const data_chunk& filter) NOEXCEPT;
 
+/// Compute the header chain of contiguous filters. Filter hashes are computed
+/// across the thread pool, then headers are folded in one sequential pass.
+/// To resume, pass the last header of a prior range (or a checkpoint).
+BC_API hashes compute_headers(const hash_digest& previous_header,
+    const data_stack& filters) NOEXCEPT;
+
+BC_API hashes compute_headers(hashes& filter_hashes,
+    const hash_digest& previous_header, const data_stack& filters) NOEXCEPT;
+
 BC_API bool match_filter(const block_filter& filter,
     const chain::script& script) NOEXCEPT;
 
@@ -59,6 +78,14 @@ BC_API bool match_filter(const block_filter& filter,
 BC_API bool match_filter(const block_filter& filter,
     const wallet::payment_address::list& addresses) NOEXCEPT;
 
+/// Match contiguous filters, the first at first_height, across the thread
+/// pool. Returns the ascending heights of filters that match any script.
+BC_API heights rescan(const block_filters& filters, size_t first_height,
+    const chain::scripts& scripts) NOEXCEPT;
+
+BC_API heights rescan(const block_filters& filters, size_t first_height,
+    const wallet::payment_address::list& addresses) NOEXCEPT;
+
 } // namespace neutrino
 } // namespace system
 } // namespace libbitcoin
@@ -30,6 +30,8 @@
 #include <bitcoin/system/chain/enums/opcode.hpp>
 #include <bitcoin/system/chain/point.hpp>
 #include <bitcoin/system/chain/script.hpp>
+#include <bitcoin/system/chain/taproot.hpp>
+#include <bitcoin/system/chain/witness.hpp>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/error/error.hpp>
@@ -103,6 +105,18 @@ block::block(reader& source, bool witness) NOEXCEPT
     assign_data(source, witness);
 }
 
+block::block(slice_reader&& source, bool witness) NOEXCEPT
+  : block(source, witness)
+{
+}
+
+block::block(slice_reader& source, bool witness) NOEXCEPT
+  : header_(CREATE(chain::header, source.get_allocator(), source)),
+    txs_(CREATE(transaction_cptrs, source.get_allocator()))
+{
+    assign_data(source, witness);
+}
+
 // protected
 block::block(const chain::header::cptr& header,
     const transactions_cptr& txs, bool valid) NOEXCEPT
@@ -131,9 +145,10 @@ bool block::operator!=(const block& other) const NOEXCEPT
 // ----------------------------------------------------------------------------
 
 // private
-void block::assign_data(reader& source, bool witness) NOEXCEPT
+template <typename Source>
+void block::assign_data(Source& source, bool witness) NOEXCEPT
 {
-    auto& allocator = source.get_allocator();
+    byte_allocator& allocator = source.get_allocator();
     const auto count = source.read_size(max_block_size);
     auto txs = to_non_const_raw_ptr(txs_);
     txs->reserve(count);
@@ -161,8 +176,7 @@ size_t block::get_allocation() const NOEXCEPT
 data_chunk block::to_data(bool witness) const NOEXCEPT
 {
     data_chunk data(serialized_size(witness));
-    stream::out::fast ostream(data);
-    write::bytes::fast out(ostream);
+    write::bytes::slab out(data);
     to_data(out, witness);
     return data;
 }
@@ -174,6 +188,18 @@ void block::to_data(std::ostream& stream, bool witness) const NOEXCEPT
 }
 
 void block::to_data(writer& sink, bool witness) const NOEXCEPT
+{
+    serialize(sink, witness);
+}
+
+void block::to_data(slab_writer& sink, bool witness) const NOEXCEPT
+{
+    serialize(sink, witness);
+}
+
+// private
+template <typename Sink>
+void block::serialize(Sink& sink, bool witness) const NOEXCEPT
 {
     header_->to_data(sink);
     sink.write_variable(txs_->size());
@@ -288,7 +314,7 @@ const hash_digest& block::get_hash() const NOEXCEPT
     return header_->get_hash();
 }
 
-void block::set_hashes(const data_chunk& data) NOEXCEPT
+void block::set_hashes(const data_slice& data) NOEXCEPT
 {
     constexpr auto header_size = chain::header::serialized_size();
 
@@ -732,6 +758,27 @@ bool block::is_unspent_coinbase_collision() const NOEXCEPT
     return !txs_->front()->inputs_ptr()->front()->metadata.spent;
 }
 
+// Batch and owners are in block (input) order.
+void block::verify_commitments(taproot::commitments& out_batch,
+    std_vector<const input*>& out_owners) const NOEXCEPT
+{
+    if (is_empty())
+        return;
+
+    for (auto tx = std::next(txs_->begin()); tx != txs_->end(); ++tx)
+    {
+        for (const auto& in: *(*tx)->inputs_ptr())
+        {
+            if (in->prevout && in->witness().extract_commitment(out_batch,
+                in->prevout->script()))
+                out_owners.push_back(in.get());
+        }
+    }
+
+    if (!out_batch.empty())
+        taproot::verify_commits(out_batch);
+}
+
 // Search is unordered, forward refs (and duplicates) caught by block.check.
 void block::populate() const NOEXCEPT
 {
@@ -842,10 +889,41 @@ code block::accept_transactions(const context& ctx) const NOEXCEPT
 // Do NOT invoke on coinbase.
 code block::connect_transactions(const context& ctx) const NOEXCEPT
 {
-    if (!is_empty())
-        for (auto tx = std::next(txs_->begin()); tx != txs_->end(); ++tx)
-            if (const auto ec = (*tx)->connect(ctx))
-                return ec;
+    if (is_empty())
+        return error::block_success;
+
+    // Commitment results are held only for the scope of this connect.
+    // Failed commitments are not passed, so connect reproduces their errors.
+    taproot::commitments batch{};
+    std_vector<const input*> owners{};
+    if (script::is_enabled(ctx.flags, flags::bip341_rule))
+        verify_commitments(batch, owners);
+
+    size_t item{};
+    taproot::commitment_ptrs verified{};
+    for (auto tx = std::next(txs_->begin()); tx != txs_->end(); ++tx)
+    {
+        // Verified commitment of each input of tx, empty if none remain.
+        verified.clear();
+        if (item < owners.size())
+        {
+            for (const auto& in: *(*tx)->inputs_ptr())
+            {
+                const taproot::commitment* commitment{};
+                if (item < owners.size() && owners.at(item) == in.get())
+                {
+                    const auto& owned = batch.at(item++);
+                    if (owned.valid)
+                        commitment = &owned;
+                }
+
+                verified.push_back(commitment);
+            }
+        }
+
+        if (const auto ec = (*tx)->connect(ctx, verified))
+            return ec;
+    }
 
     return error::block_success;
 }
@@ -888,7 +966,6 @@ code block::identify(const context& ctx) const NOEXCEPT
 // In the case of validation failure
 // The block header is checked/accepted independently.
 
-// Use of get_hash() in is_forward_reference makes this thread-unsafe.
 code block::check() const NOEXCEPT
 {
     // empty_block is subset of first_not_coinbase.
@@ -918,7 +995,6 @@ code block::check() const NOEXCEPT
 // timestamp
 // median_time_past
 
-// Use of get_hash() in is_hash_limit_exceeded makes this thread-unsafe.
 // bip141 should be disabled when the node is not accepting witness data.
 code block::check(const context& ctx) const NOEXCEPT
 {
@@ -975,8 +1051,13 @@ code block::confirm(const context& ctx) const NOEXCEPT
 // forks
 
 // This assumes that prevout caching is completed on all inputs.
+// Assumed valid blocks bypass script execution, all other rules are applied
+// by check/accept/confirm, so only connect is affected by the flag.
 code block::connect(const context& ctx) const NOEXCEPT
 {
+    if (ctx.is_assumed_valid())
+        return error::block_success;
+
     return connect_transactions(ctx);
 }
 
@@ -0,0 +1,223 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/chain/block_file.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/math/math.hpp>
+#include <bitcoin/system/stream/stream.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+// Magic and size prefix.
+constexpr size_t frame_prefix = sizeof(uint32_t) + sizeof(uint32_t);
+
+block_file::frames block_file::scan(const data_slice& file,
+    uint32_t magic) NOEXCEPT
+{
+    frames out{};
+    size_t offset{};
+    const auto data = file.data();
+    const auto size = file.size();
+
+    while (frame_prefix <= size - offset)
+    {
+        const auto prefix = std::next(data, offset);
+        if (unsafe_from_little_endian<uint32_t>(prefix) != magic)
+            break;
+
+        const size_t bytes = unsafe_from_little_endian<uint32_t>(
+            std::next(prefix, sizeof(uint32_t)));
+
+        offset += frame_prefix;
+        if (bytes > size - offset)
+            break;
+
+        out.push_back({ offset, bytes });
+        offset += bytes;
+    }
+
+    return out;
+}
+
+block_file::block_file(size_t threads, size_t window) NOEXCEPT
+  : threads_(is_zero(threads) ? std::max(one,
+        size_t{ std::thread::hardware_concurrency() }) : threads),
+    window_(std::max(one, window))
+{
+}
+
+bool block_file::import(const data_slice& file, uint32_t magic,
+    const handler& handler) NOEXCEPT
+{
+    typedef std::pair<code, block::cptr> result;
+
+    blocks_ = zero;
+    bytes_ = zero;
+    depth_ = zero;
+    peak_depth_ = zero;
+    start_ = clock::now().time_since_epoch().count();
+
+    const auto frames = scan(file, magic);
+    const auto count = frames.size();
+
+    std::mutex mutex{};
+    std::condition_variable ready{};
+    std::condition_variable space{};
+    std::map<size_t, result> buffer{};
+    std::atomic<size_t> next{};
+    size_t emitted{};
+    bool stopped{};
+
+    // Workers claim frames in order, waiting for reorder buffer space.
+    const auto work = [&]() NOEXCEPT
+    {
+        for (auto index = next++; index < count; index = next++)
+        {
+            {
+                std::unique_lock lock(mutex);
+                space.wait(lock, [&]() NOEXCEPT
+                {
+                    return stopped || index < emitted + window_;
+                });
+
+                if (stopped)
+                    return;
+            }
+
+            const auto& frame = frames.at(index);
+            const data_slice bytes(std::next(file.data(), frame.offset),
+                std::next(file.data(), frame.offset + frame.size));
+
+            slice_reader source(bytes);
+            auto block = std::make_shared<chain::block>(source, true);
+
+            result value{ error::invalid_frame, nullptr };
+            if (block->is_valid() && source.is_exhausted())
+            {
+                block->set_hashes(bytes);
+                value = { block->check(), std::move(block) };
+            }
+
+            {
+                std::unique_lock lock(mutex);
+                buffer.emplace(index, std::move(value));
+                const auto depth = buffer.size();
+                depth_ = depth;
+                peak_depth_ = std::max(peak_depth_.load(), depth);
+            }
+
+            ready.notify_one();
+        }
+    };
+
+    std::vector<std::thread> workers{};
+    workers.reserve(std::min(threads_, count));
+    for (size_t thread = 0; thread < std::min(threads_, count); ++thread)
+        workers.emplace_back(work);
+
+    // Blocks are emitted on this thread in frame order, outside of the lock.
+    for (; emitted < count && !stopped;)
+    {
+        result value{};
+        {
+            std::unique_lock lock(mutex);
+            ready.wait(lock, [&]() NOEXCEPT
+            {
+                return buffer.contains(emitted);
+            });
+
+            const auto it = buffer.find(emitted);
+            value = std::move(it->second);
+            buffer.erase(it);
+            depth_ = buffer.size();
+        }
+
+        const auto continued = handler(value.first, value.second);
+        bytes_ += frames.at(emitted).size;
+        ++blocks_;
+
+        {
+            std::unique_lock lock(mutex);
+            ++emitted;
+            stopped = !continued;
+        }
+
+        space.notify_all();
+    }
+
+    for (auto& worker: workers)
+        worker.join();
+
+    return !stopped;
+}
+
+size_t block_file::blocks() const NOEXCEPT
+{
+    return blocks_;
+}
+
+size_t block_file::bytes() const NOEXCEPT
+{
+    return bytes_;
+}
+
+size_t block_file::throughput() const NOEXCEPT
+{
+    using namespace std::chrono;
+    const auto start = clock::time_point{ clock::duration{ start_.load() } };
+    const auto elapsed = duration_cast<milliseconds>(clock::now() - start);
+    const auto span = std::max(int64_t{ 1 }, int64_t{ elapsed.count() });
+    return (bytes_ * 1000u) / static_cast<size_t>(span);
+}
+
+size_t block_file::depth() const NOEXCEPT
+{
+    return depth_;
+}
+
+size_t block_file::peak_depth() const NOEXCEPT
+{
+    return peak_depth_;
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
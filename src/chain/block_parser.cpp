@@ -0,0 +1,436 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/chain/block_parser.hpp>
+
+#include <iterator>
+#include <memory>
+#include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/chain/enums/magic_numbers.hpp>
+#include <bitcoin/system/chain/header.hpp>
+#include <bitcoin/system/chain/point.hpp>
+#include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/math/math.hpp>
+#include <bitcoin/system/stream/stream.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+
+block_parser::block_parser() NOEXCEPT
+{
+    reset();
+}
+
+block_parser::result block_parser::push(const data_slice& fragment) NOEXCEPT
+{
+    if (result_ != result::incomplete)
+        return result_;
+
+    buffer_.insert(buffer_.end(), fragment.begin(), fragment.end());
+
+    while (result_ == result::incomplete && parse_next());
+
+    // Completed objects are discarded, retaining only the one in progress.
+    buffer_.erase(buffer_.begin(), std::next(buffer_.begin(), start_));
+    position_ -= start_;
+    start_ = zero;
+
+    if (result_ == result::complete && !buffer_.empty())
+        result_ = result::invalid;
+
+    return result_;
+}
+
+void block_parser::reset() NOEXCEPT
+{
+    buffer_.clear();
+    start_ = zero;
+    position_ = zero;
+    offset_ = zero;
+    result_ = result::incomplete;
+    phase_ = phase::header;
+    step_ = step::version;
+    inputs_ = zero;
+    outputs_ = zero;
+    elements_ = zero;
+    index_ = zero;
+    element_ = zero;
+    witness_start_ = zero;
+    segregated_ = false;
+    count_ = zero;
+    header_.reset();
+    txs_ = std::make_shared<transaction_cptrs>();
+    bounds_.clear();
+    block_.reset();
+}
+
+block_parser::result block_parser::state() const NOEXCEPT
+{
+    return result_;
+}
+
+const header::cptr& block_parser::header_ptr() const NOEXCEPT
+{
+    return header_;
+}
+
+const transaction_cptrs& block_parser::transactions() const NOEXCEPT
+{
+    return *txs_;
+}
+
+const wire_scanner::bounds_list& block_parser::bounds() const NOEXCEPT
+{
+    return bounds_;
+}
+
+const block::cptr& block_parser::block_ptr() const NOEXCEPT
+{
+    return block_;
+}
+
+// private
+// ----------------------------------------------------------------------------
+// Reads are all or nothing, so an incomplete field is retried from its start
+// when more bytes arrive (no partial field state is required).
+
+bool block_parser::available(size_t size) const NOEXCEPT
+{
+    return size <= buffer_.size() - position_;
+}
+
+bool block_parser::skip(size_t size) NOEXCEPT
+{
+    if (!available(size))
+        return false;
+
+    position_ += size;
+    return true;
+}
+
+bool block_parser::read_size(size_t& out, size_t limit) NOEXCEPT
+{
+    if (!available(one))
+        return false;
+
+    const auto data = std::next(buffer_.data(), position_);
+    const auto prefix = *data;
+    const auto size = size_variable(prefix);
+    if (!available(size))
+        return false;
+
+    uint64_t value{};
+    const auto next = std::next(data);
+    switch (size)
+    {
+        case sizeof(uint8_t):
+            value = prefix;
+            break;
+        case add1(sizeof(uint16_t)):
+            value = unsafe_from_little_endian<uint16_t>(next);
+            break;
+        case add1(sizeof(uint32_t)):
+            value = unsafe_from_little_endian<uint32_t>(next);
+            break;
+        default:
+            value = unsafe_from_little_endian<uint64_t>(next);
+    }
+
+    if (value > limit)
+    {
+        result_ = result::invalid;
+        return false;
+    }
+
+    out = static_cast<size_t>(value);
+    position_ += size;
+    return true;
+}
+
+bool block_parser::skip_sized(size_t limit) NOEXCEPT
+{
+    const auto start = position_;
+    size_t size{};
+    if (!read_size(size, limit))
+        return false;
+
+    if (skip(size))
+        return true;
+
+    // Retain the size prefix until its body is also available.
+    position_ = start;
+    return false;
+}
+
+bool block_parser::parse_next() NOEXCEPT
+{
+    switch (phase_)
+    {
+        case phase::header:
+        {
+            constexpr auto size = header::serialized_size();
+            if (!available(size))
+                return false;
+
+            const auto data = std::next(buffer_.data(), position_);
+            const auto pointer = std::make_shared<chain::header>(
+                slice_reader{ data, size });
+            pointer->set_hash(bitcoin_hash(size, data));
+            header_ = pointer;
+
+            position_ += size;
+            offset_ += size;
+            start_ = position_;
+            phase_ = phase::count;
+            return true;
+        }
+        case phase::count:
+        {
+            const auto start = position_;
+            if (!read_size(count_, max_block_size))
+                return false;
+
+            txs_->reserve(count_);
+            bounds_.reserve(count_);
+            offset_ += position_ - start;
+            start_ = position_;
+            phase_ = phase::transactions;
+            break;
+        }
+        case phase::transactions:
+        {
+            if (!parse_transaction() || !complete_transaction())
+                return false;
+
+            break;
+        }
+    }
+
+    if (txs_->size() == count_)
+    {
+        block_ = std::make_shared<chain::block>(header_, txs_);
+        result_ = block_->is_valid() ? result::complete : result::invalid;
+    }
+
+    return true;
+}
+
+bool block_parser::parse_transaction() NOEXCEPT
+{
+    while (true)
+    {
+        switch (step_)
+        {
+            case step::version:
+            {
+                if (!skip(sizeof(uint32_t)))
+                    return false;
+
+                step_ = step::inputs;
+                break;
+            }
+            case step::inputs:
+            {
+                if (!read_size(inputs_, max_block_size))
+                    return false;
+
+                index_ = zero;
+                step_ = inputs_ == witness_marker ? step::flag : step::input;
+                break;
+            }
+            case step::flag:
+            {
+                // Detect witness as no inputs (marker) and expected flag.
+                if (!available(one))
+                    return false;
+
+                segregated_ = buffer_.at(position_) == witness_enabled;
+                if (segregated_)
+                    ++position_;
+
+                step_ = segregated_ ? step::witness_inputs : step::outputs;
+                break;
+            }
+            case step::witness_inputs:
+            {
+                if (!read_size(inputs_, max_block_size))
+                    return false;
+
+                step_ = step::input;
+                break;
+            }
+            case step::input:
+            {
+                if (index_ == inputs_)
+                {
+                    step_ = step::outputs;
+                    break;
+                }
+
+                if (!skip(point::serialized_size()))
+                    return false;
+
+                step_ = step::input_script;
+                break;
+            }
+            case step::input_script:
+            {
+                if (!skip_sized(max_block_weight))
+                    return false;
+
+                step_ = step::sequence;
+                break;
+            }
+            case step::sequence:
+            {
+                if (!skip(sizeof(uint32_t)))
+                    return false;
+
+                ++index_;
+                step_ = step::input;
+                break;
+            }
+            case step::outputs:
+            {
+                if (!read_size(outputs_, max_block_size))
+                    return false;
+
+                index_ = zero;
+                step_ = step::output;
+                break;
+            }
+            case step::output:
+            {
+                if (index_ == outputs_)
+                {
+                    index_ = zero;
+                    witness_start_ = position_;
+                    step_ = segregated_ ? step::witnesses : step::locktime;
+                    break;
+                }
+
+                if (!skip(sizeof(uint64_t)))
+                    return false;
+
+                step_ = step::output_script;
+                break;
+            }
+            case step::output_script:
+            {
+                if (!skip_sized(max_block_weight))
+                    return false;
+
+                ++index_;
+                step_ = step::output;
+                break;
+            }
+            case step::witnesses:
+            {
+                if (index_ == inputs_)
+                {
+                    step_ = step::locktime;
+                    break;
+                }
+
+                if (!read_size(elements_, max_block_weight))
+                    return false;
+
+                element_ = zero;
+                step_ = step::element;
+                break;
+            }
+            case step::element:
+            {
+                if (element_ == elements_)
+                {
+                    ++index_;
+                    step_ = step::witnesses;
+                    break;
+                }
+
+                if (!skip_sized(max_block_weight))
+                    return false;
+
+                ++element_;
+                break;
+            }
+            case step::locktime:
+            {
+                return skip(sizeof(uint32_t));
+            }
+        }
+    }
+}
+
+bool block_parser::complete_transaction() NOEXCEPT
+{
+    constexpr auto marker_size = sizeof(witness_marker) +
+        sizeof(witness_enabled);
+
+    const auto data = std::next(buffer_.data(), start_);
+    const auto witnessed = position_ - start_;
+    const auto witness = segregated_ ? position_ - sizeof(uint32_t) -
+        witness_start_ : zero;
+    const auto nominal = segregated_ ? witnessed - marker_size - witness :
+        witnessed;
+
+    const auto tx = std::make_shared<transaction>(
+        slice_reader{ data, witnessed }, true);
+
+    if (!tx->is_valid())
+    {
+        result_ = result::invalid;
+        return false;
+    }
+
+    if (segregated_)
+    {
+        tx->set_nominal_hash(transaction::desegregated_hash(witnessed,
+            nominal, data));
+
+        // Witness coinbase tx hash is assumed to be null_hash [bip141].
+        if (!txs_->empty())
+            tx->set_witness_hash(bitcoin_hash(witnessed, data));
+    }
+    else
+    {
+        tx->set_nominal_hash(bitcoin_hash(witnessed, data));
+    }
+
+    txs_->push_back(tx);
+    bounds_.push_back({ offset_, nominal, witnessed, segregated_ });
+
+    offset_ += witnessed;
+    start_ = position_;
+    step_ = step::version;
+    segregated_ = false;
+    return true;
+}
+
+BC_POP_WARNING()
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
@@ -334,14 +334,24 @@ size_t chain_state::retarget_height(size_t height, const forks& forks,
 uint32_t chain_state::median_time_past(const data& values,
     const forks&) NOEXCEPT
 {
-    // Sort the times by value to obtain the median.
-    auto times = sort_copy(values.timestamp.ordered);
+    const auto& ordered = values.timestamp.ordered;
+    const auto count = ordered.size();
+    if (is_zero(count))
+        return 0;
 
     // Consensus defines median time using modulo 2 element selection.
     // This differs from arithmetic median which averages two middle values.
-    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-    return times.empty() ? 0 : times.at(to_half(times.size()));
-    BC_POP_WARNING()
+    // Windows are bounded by map, but a larger set is supported via copy.
+    if (count > median_time_past_interval)
+        return sort_copy(ordered)[to_half(count)];
+
+    // Partially order a stack copy of the (at most 11) times by value.
+    std_array<uint32_t, median_time_past_interval> times{};
+    std::copy(ordered.begin(), ordered.end(), times.begin());
+    const auto end = std::next(times.begin(), count);
+    const auto middle = std::next(times.begin(), to_half(count));
+    std::nth_element(times.begin(), middle, end);
+    return *middle;
 }
 
 // work_required
@@ -574,6 +584,24 @@ chain_state::map chain_state::get_map(size_t height,
     return map;
 }
 
+void chain_state::reserve(data& values, const map& map) NOEXCEPT
+{
+    // Promotion pushes before popping, so each window requires one more.
+    values.bits.ordered.reserve(add1(map.bits.count));
+    values.version.ordered.reserve(add1(map.version.count));
+    values.timestamp.ordered.reserve(add1(map.timestamp.count));
+}
+
+void chain_state::roll(data& values, const header& header,
+    const system::settings& settings) NOEXCEPT
+{
+    BC_ASSERT(header.previous_block_hash() == values.hash);
+
+    // Promote and replace in place, equivalent to to_header without a copy.
+    promote(values, settings.forks, settings);
+    assign(values, header, settings);
+}
+
 uint32_t chain_state::signal_version(const system::settings& settings) NOEXCEPT
 {
     const auto& forks = settings.forks;
@@ -608,16 +636,10 @@ uint32_t chain_state::signal_version(const system::settings& settings) NOEXCEPT
 // Constructors.
 // ----------------------------------------------------------------------------
 
-// This is promotion from a preceding height to the next.
-chain_state::data chain_state::to_pool(const chain_state& top,
+// This is promotion from a preceding height to the next (in place).
+void chain_state::promote(data& data, const forks& forks,
     const system::settings& settings) NOEXCEPT
 {
-    // Alias configured forks.
-    const auto& forks = top.forks_;
-
-    // Copy data from presumed previous-height block state.
-    chain_state::data data{ top.data_ };
-
     // If this overflows height is zero and result is handled as invalid.
     const auto height = add1(data.height);
     
@@ -662,6 +684,42 @@ chain_state::data chain_state::to_pool(const chain_state& top,
     data.hash = {};
     data.bits.self = 0;
     data.version.self = signal_version(settings);
+}
+
+// Replace promoted (pool) state with the given header at same (next) height.
+void chain_state::assign(data& data, const header& header,
+    const system::settings& settings) NOEXCEPT
+{
+    // Preserve data.timestamp.retarget promotion.
+    data.hash = header.hash();
+    data.bits.self = header.bits();
+    data.version.self = header.version();
+    data.timestamp.self = header.timestamp();
+    data.cumulative_work += header.fixed_proof();
+
+    // Cache hash of bip30_deactivate block, otherwise use preceding state.
+    if (data.height == settings.bip30_deactivate_checkpoint.height())
+        data.bip30_deactivate_hash = data.hash;
+
+    // Cache hash of bip9 bit0 height block, otherwise use preceding state.
+    if (data.height == settings.bip9_bit0_active_checkpoint.height())
+        data.bip9_bit0_hash = data.hash;
+
+    // Cache hash of bip9 bit1 height block, otherwise use preceding state.
+    if (data.height == settings.bip9_bit1_active_checkpoint.height())
+        data.bip9_bit1_hash = data.hash;
+
+    // Cache hash of bip9 bit2 height block, otherwise use preceding state.
+    if (data.height == settings.bip9_bit2_active_checkpoint.height())
+        data.bip9_bit2_hash = data.hash;
+}
+
+chain_state::data chain_state::to_pool(const chain_state& top,
+    const system::settings& settings) NOEXCEPT
+{
+    // Copy data from presumed previous-height block state.
+    chain_state::data data{ top.data_ };
+    promote(data, top.forks_, settings);
     return data;
 }
 
@@ -673,7 +731,8 @@ chain_state::chain_state(const chain_state& top,
     forks_(top.forks_),
     activations_(activation(data_, forks_, settings)),
     work_required_(work_required(data_, forks_, settings)),
-    median_time_past_(median_time_past(data_, forks_))
+    median_time_past_(median_time_past(data_, forks_)),
+    cumulative_work_(uint256_t{ data_.cumulative_work })
 {
 }
 
@@ -690,7 +749,7 @@ chain_state::data chain_state::to_block(const chain_state& pool,
     data.bits.self = header.bits();
     data.version.self = header.version();
     data.timestamp.self = header.timestamp();
-    data.cumulative_work += header.proof();
+    data.cumulative_work += header.fixed_proof();
 
     // Cache hash of bip30_deactivate block, otherwise use preceding state.
     if (data.height == settings.bip30_deactivate_checkpoint.height())
@@ -719,7 +778,8 @@ chain_state::chain_state(const chain_state& pool, const block& block,
     forks_(pool.forks_),
     activations_(activation(data_, forks_, settings)),
     work_required_(work_required(data_, forks_, settings)),
-    median_time_past_(median_time_past(data_, forks_))
+    median_time_past_(median_time_past(data_, forks_)),
+    cumulative_work_(uint256_t{ data_.cumulative_work })
 {
 }
 
@@ -732,29 +792,7 @@ chain_state::data chain_state::to_header(const chain_state& parent,
     auto data = to_pool(parent, settings);
 
     // Replace the parent (pool or previous) block state with given state.
-    // Preserve data.timestamp.retarget promotion.
-    data.hash = header.hash();
-    data.bits.self = header.bits();
-    data.version.self = header.version();
-    data.timestamp.self = header.timestamp();
-    data.cumulative_work += header.proof();
-
-    // Cache hash of bip30_deactivate block, otherwise use preceding state.
-    if (data.height == settings.bip30_deactivate_checkpoint.height())
-        data.bip30_deactivate_hash = data.hash;
-
-    // Cache hash of bip9 bit0 height block, otherwise use preceding state.
-    if (data.height == settings.bip9_bit0_active_checkpoint.height())
-        data.bip9_bit0_hash = data.hash;
-
-    // Cache hash of bip9 bit1 height block, otherwise use preceding state.
-    if (data.height == settings.bip9_bit1_active_checkpoint.height())
-        data.bip9_bit1_hash = data.hash;
-
-    // Cache hash of bip9 bit2 height block, otherwise use preceding state.
-    if (data.height == settings.bip9_bit2_active_checkpoint.height())
-        data.bip9_bit2_hash = data.hash;
-
+    assign(data, header, settings);
     return data;
 }
 
@@ -766,7 +804,8 @@ chain_state::chain_state(const chain_state& parent, const header& header,
     forks_(parent.forks_),
     activations_(activation(data_, forks_, settings)),
     work_required_(work_required(data_, forks_, settings)),
-    median_time_past_(median_time_past(data_, forks_))
+    median_time_past_(median_time_past(data_, forks_)),
+    cumulative_work_(uint256_t{ data_.cumulative_work })
 {
 }
 
@@ -777,7 +816,8 @@ chain_state::chain_state(data&& values,
     forks_(settings.forks),
     activations_(activation(data_, forks_, settings)),
     work_required_(work_required(data_, forks_, settings)),
-    median_time_past_(median_time_past(data_, forks_))
+    median_time_past_(median_time_past(data_, forks_)),
+    cumulative_work_(uint256_t{ data_.cumulative_work })
 {
 }
 
@@ -803,6 +843,11 @@ const hash_digest& chain_state::hash() const NOEXCEPT
 }
 
 const uint256_t& chain_state::cumulative_work() const NOEXCEPT
+{
+    return cumulative_work_;
+}
+
+const uint256& chain_state::fixed_cumulative_work() const NOEXCEPT
 {
     return data_.cumulative_work;
 }
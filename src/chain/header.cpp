@@ -89,6 +89,16 @@ header::header(reader& source) NOEXCEPT
     assign_data(source);
 }
 
+header::header(slice_reader&& source) NOEXCEPT
+  : header(source)
+{
+}
+
+header::header(slice_reader& source) NOEXCEPT
+{
+    assign_data(source);
+}
+
 // protected
 header::header(uint32_t version, hash_digest&& previous_block_hash,
     hash_digest&& merkle_root, uint32_t timestamp, uint32_t bits,
@@ -152,14 +162,31 @@ void header::assign_data(reader& source) NOEXCEPT
     valid_ = source;
 }
 
+// private
+void header::assign_data(slice_reader& source) NOEXCEPT
+{
+    // Fixed size, so bounds are checked once and fields are parsed in place.
+    static const data_array<serialized_size()> empty{};
+    const auto data = source.read_pointer(serialized_size());
+    const auto& bytes = (data == nullptr) ? empty :
+        unsafe_array_cast<uint8_t, serialized_size()>(data);
+
+    version_ = from_little_endian<uint32_t>(slice<0, 4>(bytes));
+    previous_block_hash_ = slice<4, 36>(bytes);
+    merkle_root_ = slice<36, 68>(bytes);
+    timestamp_ = from_little_endian<uint32_t>(slice<68, 72>(bytes));
+    bits_ = from_little_endian<uint32_t>(slice<72, 76>(bytes));
+    nonce_ = from_little_endian<uint32_t>(slice<76, 80>(bytes));
+    valid_ = source;
+}
+
 // Serialization.
 // ----------------------------------------------------------------------------
 
 data_chunk header::to_data() const NOEXCEPT
 {
     data_chunk data(serialized_size());
-    stream::out::fast ostream(data);
-    write::bytes::fast out(ostream);
+    write::bytes::slab out(data);
     to_data(out);
     return data;
 }
@@ -171,6 +198,18 @@ void header::to_data(std::ostream& stream) const NOEXCEPT
 }
 
 void header::to_data(writer& sink) const NOEXCEPT
+{
+    serialize(sink);
+}
+
+void header::to_data(slab_writer& sink) const NOEXCEPT
+{
+    serialize(sink);
+}
+
+// private
+template <typename Sink>
+void header::serialize(Sink& sink) const NOEXCEPT
 {
     sink.write_4_bytes_little_endian(version_);
     sink.write_bytes(previous_block_hash_);
@@ -221,7 +260,13 @@ uint32_t header::nonce() const NOEXCEPT
 // static/computed
 uint256_t header::proof(uint32_t bits) NOEXCEPT
 {
-    auto target = compact::expand(bits);
+    return uint256_t{ fixed_proof(bits) };
+}
+
+// static/computed
+uint256 header::fixed_proof(uint32_t bits) NOEXCEPT
+{
+    auto target = compact::expand_fixed(bits);
 
     //*************************************************************************
     // CONSENSUS: bits may be overflowed, which is guarded here.
@@ -249,6 +294,13 @@ uint256_t header::proof() const NOEXCEPT
     return proof(bits_);
 }
 
+// computed
+uint256 header::fixed_proof() const NOEXCEPT
+{
+    // Returns zero if bits_ mantissa is less than one or bits_ is overflowed.
+    return fixed_proof(bits_);
+}
+
 // computed
 hash_digest header::hash() const NOEXCEPT
 {
@@ -271,15 +323,12 @@ hash_digest header::hash() const NOEXCEPT
 
 void header::set_hash(const hash_digest& hash) const NOEXCEPT
 {
-    hash_ = hash;
+    hash_.set(hash);
 }
 
 const hash_digest& header::get_hash() const NOEXCEPT
 {
-    if (!hash_)
-        set_hash(hash());
-
-    return *hash_;
+    return hash_.get([this]() NOEXCEPT { return hash(); });
 }
 
 const chain_state::cptr& header::get_state() const NOEXCEPT
@@ -298,8 +347,8 @@ void header::set_state(const chain_state::cptr& state) const NOEXCEPT
 bool header::is_invalid_proof_of_work(uint32_t proof_of_work_limit,
     bool scrypt) const NOEXCEPT
 {
-    static const auto limit = compact::expand(proof_of_work_limit);
-    const auto target = compact::expand(bits_);
+    static const auto limit = compact::expand_fixed(proof_of_work_limit);
+    const auto target = compact::expand_fixed(bits_);
 
     //*************************************************************************
     // CONSENSUS: bits_ may be overflowed, which is guarded here.
@@ -313,7 +362,8 @@ bool header::is_invalid_proof_of_work(uint32_t proof_of_work_limit,
         return true;
 
     // Conditionally use scrypt proof of work (e.g. Litecoin).
-    return to_uintx(scrypt ? scrypt_hash(to_data()) : hash()) > target;
+    return uint256::from_little_endian(scrypt ? scrypt_hash(to_data()) :
+        hash()) > target;
 }
 
 // ****************************************************************************
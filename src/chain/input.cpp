@@ -139,6 +139,11 @@ input::input(const chain::point::cptr& point, const chain::script::cptr& script,
 {
 }
 
+input::input(const data_chunk& data) NOEXCEPT
+  : input(slice_reader(data))
+{
+}
+
 input::input(stream::in::fast&& stream) NOEXCEPT
   : input(read::bytes::fast(stream))
 {
@@ -175,6 +180,22 @@ input::input(reader& source) NOEXCEPT
 {
 }
 
+input::input(slice_reader&& source) NOEXCEPT
+  : input(source)
+{
+}
+
+// Witness is deserialized and assigned by transaction.
+input::input(slice_reader& source) NOEXCEPT
+  : point_(CREATE(chain::point, source.get_allocator(), source)),
+    script_(CREATE(chain::script, source.get_allocator(), source, true)),
+    witness_(CREATE(chain::witness, source.get_allocator())),
+    sequence_(source.read_4_bytes_little_endian()),
+    valid_(source),
+    size_(serialized_size(*script_))
+{
+}
+
 // protected
 input::input(const chain::point::cptr& point, const chain::script::cptr& script,
     const chain::witness::cptr& witness, uint32_t sequence, bool valid) NOEXCEPT
@@ -233,8 +254,7 @@ bool operator!=(const cref_point& left, const cref_point& right) NOEXCEPT
 data_chunk input::to_data() const NOEXCEPT
 {
     data_chunk data(serialized_size(false));
-    stream::out::fast ostream(data);
-    write::bytes::fast out(ostream);
+    write::bytes::slab out(data);
     to_data(out);
     return data;
 }
@@ -245,8 +265,25 @@ void input::to_data(std::ostream& stream) const NOEXCEPT
     to_data(out);
 }
 
-// Witness is serialized by transaction.
 void input::to_data(writer& sink) const NOEXCEPT
+{
+    serialize(sink);
+}
+
+void input::to_data(slab_writer& sink) const NOEXCEPT
+{
+    serialize(sink);
+}
+
+void input::to_data(tee_writer& sink) const NOEXCEPT
+{
+    serialize(sink);
+}
+
+// Witness is serialized by transaction.
+// private
+template <typename Sink>
+void input::serialize(Sink& sink) const NOEXCEPT
 {
     point_->to_data(sink);
     script_->to_data(sink, true);
@@ -318,14 +355,19 @@ size_t input::witnessed_size() const NOEXCEPT
 ////        witness_->serialized_size(true));
 ////}
 
-void input::set_witness(reader& source) NOEXCEPT
+template <typename Source>
+void input::set_witness(Source& source) NOEXCEPT
 {
-    auto& allocator = source.get_allocator();
+    byte_allocator& allocator = source.get_allocator();
     witness_.reset(CREATE(chain::witness, allocator, source, true));
     size_.witnessed = ceilinged_add(size_.nominal,
         witness_->serialized_size(true));
 }
 
+// Called by transaction.
+template void input::set_witness<reader>(reader&) NOEXCEPT;
+template void input::set_witness<slice_reader>(slice_reader&) NOEXCEPT;
+
 // Properties.
 // ----------------------------------------------------------------------------
 
@@ -159,6 +159,16 @@ operation::operation(reader& source) NOEXCEPT
     assign_data(source);
 }
 
+operation::operation(slice_reader&& source) NOEXCEPT
+  : operation(source)
+{
+}
+
+operation::operation(slice_reader& source) NOEXCEPT
+{
+    assign_data(source);
+}
+
 operation::operation(const std::string& mnemonic) NOEXCEPT
   : operation(from_string(mnemonic))
 {
@@ -190,9 +200,10 @@ bool operation::operator!=(const operation& other) const NOEXCEPT
 // ----------------------------------------------------------------------------
 
 // private
-void operation::assign_data(reader& source) NOEXCEPT
+template <typename Source>
+void operation::assign_data(Source& source) NOEXCEPT
 {
-    auto& allocator = source.get_allocator();
+    byte_allocator& allocator = source.get_allocator();
 
     // Guard against resetting a previously-invalid stream.
     if (!source)
@@ -258,8 +269,7 @@ operation operation::from_push_data(const chunk_cptr& data,
 data_chunk operation::to_data() const NOEXCEPT
 {
     data_chunk data(serialized_size());
-    stream::out::fast ostream(data);
-    write::bytes::fast out(ostream);
+    write::bytes::slab out(data);
     to_data(out);
     return data;
 }
@@ -271,6 +281,23 @@ void operation::to_data(std::ostream& stream) const NOEXCEPT
 }
 
 void operation::to_data(writer& sink) const NOEXCEPT
+{
+    serialize(sink);
+}
+
+void operation::to_data(slab_writer& sink) const NOEXCEPT
+{
+    serialize(sink);
+}
+
+void operation::to_data(tee_writer& sink) const NOEXCEPT
+{
+    serialize(sink);
+}
+
+// private
+template <typename Sink>
+void operation::serialize(Sink& sink) const NOEXCEPT
 {
     // Underflow is op-undersized data, it is serialized with no opcode.
     // An underflow could only be a final token in a script deserialization.
@@ -530,7 +557,8 @@ size_t operation::serialized_size() const NOEXCEPT
 // static/private
 // Advances stream, returns true unless exhausted.
 // Does not advance to end position in the case of underflow operation.
-bool operation::count_op(reader& source) NOEXCEPT
+template <typename Source>
+bool operation::count_op(Source& source) NOEXCEPT
 {
     if (source.is_exhausted())
         return false;
@@ -541,7 +569,8 @@ bool operation::count_op(reader& source) NOEXCEPT
 }
 
 // static/private
-uint32_t operation::read_data_size(opcode code, reader& source) NOEXCEPT
+template <typename Source>
+uint32_t operation::read_data_size(opcode code, Source& source) NOEXCEPT
 {
     constexpr auto op_75 = static_cast<uint8_t>(opcode::push_size_75);
 
@@ -559,6 +588,10 @@ uint32_t operation::read_data_size(opcode code, reader& source) NOEXCEPT
     }
 }
 
+// Called by script.
+template bool operation::count_op<reader>(reader&) NOEXCEPT;
+template bool operation::count_op<slice_reader>(slice_reader&) NOEXCEPT;
+
 BC_POP_WARNING()
 
 // JSON value convertors.
@@ -67,6 +67,11 @@ output::output(uint64_t value, const chain::script::cptr& script) NOEXCEPT
 {
 }
 
+output::output(const data_chunk& data) NOEXCEPT
+  : output(slice_reader(data))
+{
+}
+
 output::output(stream::in::fast&& stream) NOEXCEPT
   : output(read::bytes::fast(stream))
 {
@@ -100,6 +105,19 @@ output::output(reader& source) NOEXCEPT
 {
 }
 
+output::output(slice_reader&& source) NOEXCEPT
+  : output(source)
+{
+}
+
+output::output(slice_reader& source) NOEXCEPT
+  : value_(source.read_8_bytes_little_endian()),
+    script_(CREATE(chain::script, source.get_allocator(), source, true)),
+    valid_(source),
+    size_(serialized_size(*script_, value_))
+{
+}
+
 // protected
 output::output(uint64_t value, const chain::script::cptr& script,
     bool valid) NOEXCEPT
@@ -133,8 +151,7 @@ bool output::operator!=(const output& other) const NOEXCEPT
 data_chunk output::to_data() const NOEXCEPT
 {
     data_chunk data(serialized_size());
-    stream::out::fast ostream(data);
-    write::bytes::fast out(ostream);
+    write::bytes::slab out(data);
     to_data(out);
     return data;
 }
@@ -146,6 +163,23 @@ void output::to_data(std::ostream& stream) const NOEXCEPT
 }
 
 void output::to_data(writer& sink) const NOEXCEPT
+{
+    serialize(sink);
+}
+
+void output::to_data(slab_writer& sink) const NOEXCEPT
+{
+    serialize(sink);
+}
+
+void output::to_data(tee_writer& sink) const NOEXCEPT
+{
+    serialize(sink);
+}
+
+// private
+template <typename Sink>
+void output::serialize(Sink& sink) const NOEXCEPT
 {
     sink.write_8_bytes_little_endian(value_);
     script_->to_data(sink, true);
@@ -199,14 +233,13 @@ hash_digest output::hash() const NOEXCEPT
     return out;
 }
 
-// NOT THREAD SAFE
 // Proves benefit only with multiple tapscript hash_single per input script.
 const hash_digest& output::get_hash() const NOEXCEPT
 {
-    if (!cache_)
-        cache_ = std::make_shared<const hash_digest>(hash());
-
-    return *cache_;
+    return *cache_.get([this]() NOEXCEPT
+    {
+        return std::make_shared<const hash_digest>(hash());
+    });
 }
 
 bool output::committed_hash(hash_cref& out) const NOEXCEPT
@@ -50,6 +50,11 @@ point::point(const hash_digest& hash, uint32_t index) NOEXCEPT
 {
 }
 
+point::point(const data_chunk& data) NOEXCEPT
+  : point(slice_reader(data))
+{
+}
+
 point::point(stream::in::fast&& stream) NOEXCEPT
   : point(read::bytes::fast(stream))
 {
@@ -80,6 +85,16 @@ point::point(reader& source) NOEXCEPT
     assign_data(source);
 }
 
+point::point(slice_reader&& source) NOEXCEPT
+  : point(source)
+{
+}
+
+point::point(slice_reader& source) NOEXCEPT
+{
+    assign_data(source);
+}
+
 // protected
 point::point(hash_digest&& hash, uint32_t index, bool valid) NOEXCEPT
   : hash_(std::move(hash)), index_(index), valid_(valid)
@@ -143,14 +158,28 @@ void point::assign_data(reader& source) NOEXCEPT
     valid_ = source;
 }
 
+// private
+void point::assign_data(slice_reader& source) NOEXCEPT
+{
+    // Fixed size, so bounds are checked once and fields are parsed in place.
+    static const data_array<serialized_size()> empty{};
+    const auto data = source.read_pointer(serialized_size());
+    const auto& bytes = (data == nullptr) ? empty :
+        unsafe_array_cast<uint8_t, serialized_size()>(data);
+
+    hash_ = slice<0, hash_size>(bytes);
+    index_ = from_little_endian<uint32_t>(
+        slice<hash_size, serialized_size()>(bytes));
+    valid_ = source;
+}
+
 // Serialization.
 // ----------------------------------------------------------------------------
 
 data_chunk point::to_data() const NOEXCEPT
 {
     data_chunk data(serialized_size());
-    stream::out::fast ostream(data);
-    write::bytes::fast out(ostream);
+    write::bytes::slab out(data);
     to_data(out);
     return data;
 }
@@ -162,6 +191,23 @@ void point::to_data(std::ostream& stream) const NOEXCEPT
 }
 
 void point::to_data(writer& sink) const NOEXCEPT
+{
+    serialize(sink);
+}
+
+void point::to_data(slab_writer& sink) const NOEXCEPT
+{
+    serialize(sink);
+}
+
+void point::to_data(tee_writer& sink) const NOEXCEPT
+{
+    serialize(sink);
+}
+
+// private
+template <typename Sink>
+void point::serialize(Sink& sink) const NOEXCEPT
 {
     sink.write_bytes(hash_);
     sink.write_4_bytes_little_endian(index_);
@@ -129,6 +129,17 @@ script::script(reader& source, bool prefix) NOEXCEPT
     assign_data(source, prefix);
 }
 
+script::script(slice_reader&& source, bool prefix) NOEXCEPT
+  : script(source, prefix)
+{
+}
+
+script::script(slice_reader& source, bool prefix) NOEXCEPT
+  : ops_(source.get_arena())
+{
+    assign_data(source, prefix);
+}
+
 script::script(const std::string& mnemonic) NOEXCEPT
   : script(from_string(mnemonic))
 {
@@ -189,7 +200,8 @@ bool script::operator!=(const script& other) const NOEXCEPT
 // ----------------------------------------------------------------------------
 
 // static/private
-size_t script::op_count(reader& source) NOEXCEPT
+template <typename Source>
+size_t script::op_count(Source& source) NOEXCEPT
 {
     // Stream errors reset by set_position so trap here.
     if (!source)
@@ -245,7 +257,8 @@ script script::from_operations(const operations& ops) NOEXCEPT
 }
 
 // private
-void script::assign_data(reader& source, bool prefix) NOEXCEPT
+template <typename Source>
+void script::assign_data(Source& source, bool prefix) NOEXCEPT
 {
     easier_ = false;
     failer_ = false;
@@ -326,8 +339,7 @@ script script::from_string(const std::string& mnemonic) NOEXCEPT
 data_chunk script::to_data(bool prefix) const NOEXCEPT
 {
     data_chunk data(serialized_size(prefix));
-    stream::out::fast ostream(data);
-    write::bytes::fast out(ostream);
+    write::bytes::slab out(data);
     to_data(out, prefix);
     return data;
 }
@@ -338,8 +350,25 @@ void script::to_data(std::ostream& stream, bool prefix) const NOEXCEPT
     to_data(out, prefix);
 }
 
-// see also: subscript.to_data().
 void script::to_data(writer& sink, bool prefix) const NOEXCEPT
+{
+    serialize(sink, prefix);
+}
+
+void script::to_data(slab_writer& sink, bool prefix) const NOEXCEPT
+{
+    serialize(sink, prefix);
+}
+
+void script::to_data(tee_writer& sink, bool prefix) const NOEXCEPT
+{
+    serialize(sink, prefix);
+}
+
+// private
+// see also: subscript.to_data().
+template <typename Sink>
+void script::serialize(Sink& sink, bool prefix) const NOEXCEPT
 {
     if (prefix)
         sink.write_variable(serialized_size(false));
@@ -19,6 +19,7 @@
 #include <bitcoin/system/chain/taproot.hpp>
 
 #include <algorithm>
+#include <numeric>
 #include <bitcoin/system/chain/annex.hpp>
 #include <bitcoin/system/chain/script.hpp>
 #include <bitcoin/system/chain/tapscript.hpp>
@@ -114,6 +115,72 @@ bool taproot::verify_commit(const tapscript& control, const ec_xonly& out_key,
     return verify_commitment(control.key(), tweak, out_key, control.parity());
 }
 
+void taproot::verify_commits(commitments& batch) NOEXCEPT
+{
+    using namespace schnorr;
+    constexpr auto branch = hash::sha256t::fast<"TapBranch">::midstate();
+    constexpr auto tweak = hash::sha256t::fast<"TapTweak">::midstate();
+
+    size_t depth{};
+    sha256::digests_t roots{};
+    roots.reserve(batch.size());
+    for (const auto& item: batch)
+    {
+        roots.push_back(item.leaf);
+        depth = std::max(depth, item.control.count());
+    }
+
+    // Merkle roots, with each path level hashed across the batch (as pairs).
+    std_vector<size_t> level_items{};
+    sha256::digests_t pairs{};
+    for (size_t level{}; level < depth; ++level)
+    {
+        level_items.clear();
+        pairs.clear();
+
+        for (size_t index{}; index < batch.size(); ++index)
+        {
+            const auto& control = batch.at(index).control;
+            if (level >= control.count())
+                continue;
+
+            const auto& left = roots.at(index);
+            const auto& right = control.keys().at(level);
+            const auto sorted = std::lexicographical_compare(left.begin(),
+                left.end(), right.begin(), right.end());
+
+            pairs.push_back(sorted ? left : right);
+            pairs.push_back(sorted ? right : left);
+            level_items.push_back(index);
+        }
+
+        sha256::tagged_hash(pairs, branch);
+        for (size_t item{}; item < level_items.size(); ++item)
+            roots.at(level_items.at(item)) = pairs.at(item);
+    }
+
+    // Tweak hashes (internal key and root pairs), in place of roots.
+    pairs.clear();
+    for (size_t index{}; index < batch.size(); ++index)
+    {
+        pairs.push_back(batch.at(index).control.key());
+        pairs.push_back(roots.at(index));
+    }
+
+    sha256::tagged_hash(pairs, tweak);
+
+    // Tweaked key checks are independent, so these are concurrent.
+    std_vector<size_t> indexes(batch.size());
+    std::iota(indexes.begin(), indexes.end(), zero);
+    std::for_each(poolstl::execution::par, indexes.begin(), indexes.end(),
+        [&](size_t index) NOEXCEPT
+        {
+            auto& item = batch.at(index);
+            item.valid = verify_commitment(item.control.key(),
+                pairs.at(index), item.out_key, item.control.parity());
+        });
+}
+
 } // namespace chain
 } // namespace system
 } // namespace libbitcoin
@@ -74,6 +74,12 @@ transaction::transaction(uint32_t version, const inputs_cptr& inputs,
 {
 }
 
+// Contiguous data is read by the non-virtual slice reader.
+transaction::transaction(const data_chunk& data, bool witness) NOEXCEPT
+  : transaction(slice_reader(data), witness)
+{
+}
+
 transaction::transaction(stream::in::fast&& stream, bool witness) NOEXCEPT
   : transaction(read::bytes::fast(stream), witness)
 {
@@ -107,6 +113,19 @@ transaction::transaction(reader& source, bool witness) NOEXCEPT
     assign_data(source, witness);
 }
 
+transaction::transaction(slice_reader&& source, bool witness) NOEXCEPT
+  : transaction(source, witness)
+{
+}
+
+transaction::transaction(slice_reader& source, bool witness) NOEXCEPT
+  : version_(source.read_4_bytes_little_endian()),
+    inputs_(CREATE(input_cptrs, source.get_allocator())),
+    outputs_(CREATE(output_cptrs, source.get_allocator()))
+{
+    assign_data(source, witness);
+}
+
 // protected
 transaction::transaction(uint32_t version,
     const chain::inputs_cptr& inputs, const chain::outputs_cptr& outputs,
@@ -145,9 +164,10 @@ bool transaction::operator!=(const transaction& other) const NOEXCEPT
 
 // private
 BC_PUSH_WARNING(NO_UNGUARDED_POINTERS)
-void transaction::assign_data(reader& source, bool witness) NOEXCEPT
+template <typename Source>
+void transaction::assign_data(Source& source, bool witness) NOEXCEPT
 {
-    auto& allocator = source.get_allocator();
+    byte_allocator& allocator = source.get_allocator();
     auto ins = to_non_const_raw_ptr(inputs_);
     auto count = source.read_size(max_block_size);
     ins->reserve(count);
@@ -214,12 +234,31 @@ data_chunk transaction::to_data(bool witness) const NOEXCEPT
     witness &= segregated_;
 
     data_chunk data(serialized_size(witness));
-    stream::out::fast ostream(data);
-    write::bytes::fast out(ostream);
+    write::bytes::slab out(data);
     to_data(out, witness);
     return data;
 }
 
+// Serializes and caches identity hashes in the same pass. A nominal
+// serialization caches only the nominal hash (witness is not written).
+// The tx may be shared, so caches are populated only if unset (thread safe),
+// through the same path as get_hash (not the construction-time setters).
+data_chunk transaction::to_hashed_data(bool witness) const NOEXCEPT
+{
+    witness &= segregated_;
+
+    data_chunk data(serialized_size(witness));
+    write::bytes::tee out(data, witness);
+    to_data(out, witness);
+    nominal_hash_.get([&out]() NOEXCEPT { return out.nominal_hash(); });
+
+    // Witness coinbase tx hash is assumed to be null_hash [bip141].
+    if (witness && !is_coinbase())
+        witness_hash_.get([&out]() NOEXCEPT { return out.witness_hash(); });
+
+    return data;
+}
+
 void transaction::to_data(std::ostream& stream, bool witness) const NOEXCEPT
 {
     witness &= segregated_;
@@ -229,15 +268,37 @@ void transaction::to_data(std::ostream& stream, bool witness) const NOEXCEPT
 }
 
 void transaction::to_data(writer& sink, bool witness) const NOEXCEPT
+{
+    serialize(sink, witness);
+}
+
+void transaction::to_data(slab_writer& sink, bool witness) const NOEXCEPT
+{
+    serialize(sink, witness);
+}
+
+void transaction::to_data(tee_writer& sink, bool witness) const NOEXCEPT
+{
+    serialize(sink, witness);
+}
+
+// private
+template <typename Sink>
+void transaction::serialize(Sink& sink, bool witness) const NOEXCEPT
 {
     witness &= segregated_;
 
+    // Witness sections are excluded from the tee writer's nominal hash.
+    constexpr auto tee = is_same_type<Sink, tee_writer>;
+
     sink.write_4_bytes_little_endian(version_);
 
     if (witness)
     {
+        if constexpr (tee) sink.begin_witness();
         sink.write_byte(witness_marker);
         sink.write_byte(witness_enabled);
+        if constexpr (tee) sink.end_witness();
     }
 
     sink.write_variable(inputs_->size());
@@ -249,8 +310,12 @@ void transaction::to_data(writer& sink, bool witness) const NOEXCEPT
         output->to_data(sink);
 
     if (witness)
+    {
+        if constexpr (tee) sink.begin_witness();
         for (auto& input: *inputs_)
             input->witness().to_data(sink, true);
+        if constexpr (tee) sink.end_witness();
+    }
 
     sink.write_4_bytes_little_endian(locktime_);
 }
@@ -911,19 +976,28 @@ code transaction::confirm(const context& ctx) const NOEXCEPT
 // ----------------------------------------------------------------------------
 
 code transaction::connect_input(const context& ctx,
-    const input_iterator& it) const NOEXCEPT
+    const input_iterator& it, const taproot::commitment* verified) const NOEXCEPT
 {
     using namespace machine;
 
-    // TODO: evaluate performance tradeoff.
-    if ((*it)->is_roller())
-    {
-        // Evaluate rolling scripts with linear search but constant erase.
-        return interpreter<linked_stack>::connect(ctx, *this, it);
-    }
+#if defined(HAVE_PROFILE)
+    const profiler::scope profile{ ctx.profile };
+#endif
+
+    using taproot = interpreter<inline_stack, rules::taproot>;
+    using segwit = interpreter<inline_stack, rules::segwit>;
+    using pre_segwit = interpreter<inline_stack, rules::pre_segwit>;
 
-    // Evaluate non-rolling scripts with constant search but linear erase.
-    return interpreter<contiguous_stack>::connect(ctx, *this, it);
+    // Common fork epochs evaluate with script rule branches folded away.
+    if (rules::is_epoch(ctx.flags, rules::taproot))
+        return taproot::connect(ctx, *this, it, verified);
+    if (rules::is_epoch(ctx.flags, rules::segwit))
+        return segwit::connect(ctx, *this, it, verified);
+    if (rules::is_epoch(ctx.flags, rules::pre_segwit))
+        return pre_segwit::connect(ctx, *this, it, verified);
+
+    // Evaluate all scripts with constant search and memmove erase.
+    return interpreter<inline_stack>::connect(ctx, *this, it, verified);
 }
 
 // Connect (contextual).
@@ -934,14 +1008,24 @@ code transaction::connect_input(const context& ctx,
 // forks
 
 code transaction::connect(const context& ctx) const NOEXCEPT
+{
+    return connect(ctx, {});
+}
+
+code transaction::connect(const context& ctx,
+    const taproot::commitment_ptrs& verified) const NOEXCEPT
 {
     ////BC_ASSERT(!is_coinbase());
+    BC_ASSERT(verified.empty() || verified.size() == inputs_->size());
 
-    if (is_coinbase())
+    if (is_coinbase() || ctx.is_assumed_valid())
         return error::transaction_success;
 
+    const auto none = verified.empty();
+    auto commitment = verified.begin();
     for (auto in = inputs_->begin(); in != inputs_->end(); ++in)
-        if (const auto ec = connect_input(ctx, in))
+        if (const auto ec = connect_input(ctx, in,
+            none ? nullptr : *commitment++))
             return ec;
 
     return error::transaction_success;
@@ -86,37 +86,33 @@ hash_digest transaction::hash(bool witness) const NOEXCEPT
     return digest;
 }
 
-// Cached identity hashing (not thead safe).
+// Cached identity hashing.
 // ----------------------------------------------------------------------------
 
 // Used to populate nominal hash after wire deserialization and store read.
+// Setters are not thread safe, so must be called before tx is shared.
 void transaction::set_nominal_hash(const hash_digest& hash) const NOEXCEPT
 {
-    nominal_hash_ = hash;
+    nominal_hash_.set(hash);
 }
 
 // Used to populate witness hash after wire deserialization (not stored).
 void transaction::set_witness_hash(const hash_digest& hash) const NOEXCEPT
 {
-    witness_hash_ = hash;
+    witness_hash_.set(hash);
 }
 
 // Efficient because always returns a reference and never recomputes.
+// Thread safe, concurrent callers wait on a single computation of the hash.
 const hash_digest& transaction::get_hash(bool witness) const NOEXCEPT
 {
     if (witness)
-    {
-        if (!witness_hash_) set_witness_hash(hash(witness));
-        return *witness_hash_;
-    }
+        return witness_hash_.get([this]() NOEXCEPT { return hash(true); });
     else
-    {
-        if (!nominal_hash_) set_nominal_hash(hash(witness));
-        return *nominal_hash_;
-    }
+        return nominal_hash_.get([this]() NOEXCEPT { return hash(false); });
 }
 
-// Cached signature hashing (not thead safe).
+// Cached signature hashing (thread safe).
 // ----------------------------------------------------------------------------
 
 hash_digest transaction::x1_base_hash_points() const NOEXCEPT
@@ -183,36 +179,42 @@ hash_digest transaction::v1_only_hash_scripts() const NOEXCEPT
 
 BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
 
-void transaction::set_x1_base_hash() const NOEXCEPT
+const transaction::base_cache& transaction::x1_base_hash() const NOEXCEPT
 {
-    if (!x1_base_cache_)
-        x1_base_cache_ = std::make_shared<base_cache>
+    return *x1_base_cache_.get([this]() NOEXCEPT
+    {
+        return std::make_shared<const base_cache>
         (
             x1_base_hash_points(),
             x1_base_hash_sequences(),
             x1_base_hash_outputs()
         );
+    });
 }
 
-void transaction::set_x2_base_hash() const NOEXCEPT
+const transaction::base_cache& transaction::x2_base_hash() const NOEXCEPT
 {
-    if (!x2_base_cache_)
-        x2_base_cache_ = std::make_shared<base_cache>
+    return *x2_base_cache_.get([this]() NOEXCEPT
+    {
+        return std::make_shared<const base_cache>
         (
             sha256_hash(single_hash_points()),
             sha256_hash(single_hash_sequences()),
             sha256_hash(single_hash_outputs())
         );
+    });
 }
 
-void transaction::set_v1_only_hash() const NOEXCEPT
+const transaction::only_cache& transaction::v1_only_hash() const NOEXCEPT
 {
-    if (!v1_only_cache_)
-        v1_only_cache_ = std::make_shared<only_cache>
+    return *v1_only_cache_.get([this]() NOEXCEPT
+    {
+        return std::make_shared<const only_cache>
         (
             v1_only_hash_amounts(),
             v1_only_hash_scripts()
         );
+    });
 }
 
 BC_POP_WARNING()
@@ -222,32 +224,27 @@ BC_POP_WARNING()
 
 const hash_digest& transaction::single_hash_points() const NOEXCEPT
 {
-    set_x1_base_hash();
-    return x1_base_cache_->points;
+    return x1_base_hash().points;
 }
 
 const hash_digest& transaction::single_hash_sequences() const NOEXCEPT
 {
-    set_x1_base_hash();
-    return x1_base_cache_->sequences;
+    return x1_base_hash().sequences;
 }
 
 const hash_digest& transaction::single_hash_outputs() const NOEXCEPT
 {
-    set_x1_base_hash();
-    return x1_base_cache_->outputs;
+    return x1_base_hash().outputs;
 }
 
 const hash_digest& transaction::single_hash_amounts() const NOEXCEPT
 {
-    set_v1_only_hash();
-    return v1_only_cache_->amounts;
+    return v1_only_hash().amounts;
 }
 
 const hash_digest& transaction::single_hash_scripts() const NOEXCEPT
 {
-    set_v1_only_hash();
-    return v1_only_cache_->scripts;
+    return v1_only_hash().scripts;
 }
 
 // sha256x2 (script verson 0)
@@ -255,20 +252,17 @@ const hash_digest& transaction::single_hash_scripts() const NOEXCEPT
 
 const hash_digest& transaction::double_hash_points() const NOEXCEPT
 {
-    set_x2_base_hash();
-    return x2_base_cache_->points;
+    return x2_base_hash().points;
 }
 
 const hash_digest& transaction::double_hash_sequences() const NOEXCEPT
 {
-    set_x2_base_hash();
-    return x2_base_cache_->sequences;
+    return x2_base_hash().sequences;
 }
 
 const hash_digest& transaction::double_hash_outputs() const NOEXCEPT
 {
-    set_x2_base_hash();
-    return x2_base_cache_->outputs;
+    return x2_base_hash().outputs;
 }
 
 } // namespace chain
@@ -0,0 +1,160 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/chain/wire_scanner.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <bitcoin/system/chain/enums/magic_numbers.hpp>
+#include <bitcoin/system/chain/header.hpp>
+#include <bitcoin/system/chain/point.hpp>
+#include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/math/math.hpp>
+#include <bitcoin/system/stream/stream.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+
+// local
+inline void skip_script(slice_reader& source) NOEXCEPT
+{
+    source.skip_bytes(source.read_size(max_block_weight));
+}
+
+// local
+static bool scan(wire_scanner::bounds& out, slice_reader& source) NOEXCEPT
+{
+    constexpr auto marker_size = sizeof(witness_marker) +
+        sizeof(witness_enabled);
+
+    out.offset = source.get_read_position();
+    source.skip_bytes(sizeof(uint32_t));
+
+    // Detect witness as no inputs (marker) and expected flag [bip144].
+    auto inputs = source.read_size(max_block_size);
+    out.segregated = inputs == witness_marker &&
+        source.peek_byte() == witness_enabled;
+
+    if (out.segregated)
+    {
+        source.skip_byte();
+        inputs = source.read_size(max_block_size);
+    }
+
+    for (size_t input = 0; input < inputs && source; ++input)
+    {
+        source.skip_bytes(point::serialized_size());
+        skip_script(source);
+        source.skip_bytes(sizeof(uint32_t));
+    }
+
+    const auto outputs = source.read_size(max_block_size);
+    for (size_t output = 0; output < outputs && source; ++output)
+    {
+        source.skip_bytes(sizeof(uint64_t));
+        skip_script(source);
+    }
+
+    const auto witness_start = source.get_read_position();
+    if (out.segregated)
+    {
+        for (size_t input = 0; input < inputs && source; ++input)
+        {
+            const auto elements = source.read_size(max_block_weight);
+            for (size_t element = 0; element < elements && source; ++element)
+                skip_script(source);
+        }
+    }
+
+    const auto witness = source.get_read_position() - witness_start;
+    source.skip_bytes(sizeof(uint32_t));
+
+    out.witnessed = source.get_read_position() - out.offset;
+    out.nominal = out.segregated ? out.witnessed - marker_size - witness :
+        out.witnessed;
+
+    return source;
+}
+
+bool wire_scanner::scan_transaction(bounds& out,
+    const data_slice& data) NOEXCEPT
+{
+    slice_reader source(data);
+    return scan(out, source);
+}
+
+bool wire_scanner::scan_block(bounds_list& out,
+    const data_slice& data) NOEXCEPT
+{
+    slice_reader source(data);
+    source.skip_bytes(header::serialized_size());
+
+    const auto count = source.read_size(max_block_size);
+    out.clear();
+    out.reserve(count);
+
+    for (size_t tx = 0; tx < count && source; ++tx)
+        scan(out.emplace_back(), source);
+
+    return source && source.is_exhausted();
+}
+
+hashes wire_scanner::nominal_hashes(const data_slice& data,
+    const bounds_list& bounds) NOEXCEPT
+{
+    hashes out(bounds.size());
+    std::transform(poolstl::execution::par, bounds.begin(), bounds.end(),
+        out.begin(), [&](const wire_scanner::bounds& tx) NOEXCEPT
+        {
+            const auto start = std::next(data.data(), tx.offset);
+            return tx.segregated ?
+                transaction::desegregated_hash(tx.witnessed, tx.nominal,
+                    start) : bitcoin_hash(tx.witnessed, start);
+        });
+
+    return out;
+}
+
+hashes wire_scanner::witness_hashes(const data_slice& data,
+    const bounds_list& bounds, bool coinbase) NOEXCEPT
+{
+    hashes out(bounds.size());
+    std::transform(poolstl::execution::par, bounds.begin(), bounds.end(),
+        out.begin(), [&](const wire_scanner::bounds& tx) NOEXCEPT
+        {
+            return bitcoin_hash(tx.witnessed,
+                std::next(data.data(), tx.offset));
+        });
+
+    if (coinbase && !out.empty())
+        out.front() = null_hash;
+
+    return out;
+}
+
+BC_POP_WARNING()
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
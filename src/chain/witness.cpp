@@ -94,6 +94,18 @@ witness::witness(reader& source, bool prefix) NOEXCEPT
     assign_data(source, prefix);
 }
 
+witness::witness(slice_reader&& source, bool prefix) NOEXCEPT
+  : witness(source, prefix)
+{
+}
+
+witness::witness(slice_reader& source, bool prefix) NOEXCEPT
+  : stack_(source.get_arena()), annex_()
+{
+    // annex_ may be reconstructed, since it requires the populated stack.
+    assign_data(source, prefix);
+}
+
 witness::witness(const std::string& mnemonic) NOEXCEPT
   : witness(from_string(mnemonic))
 {
@@ -151,25 +163,40 @@ static inline size_t element_size(const chunk_cptr& element) NOEXCEPT
 // static
 void witness::skip(reader& source, bool prefix) NOEXCEPT
 {
+    skip_data(source, prefix);
+}
+
+// static
+void witness::skip(slice_reader& source, bool prefix) NOEXCEPT
+{
+    skip_data(source, prefix);
+}
+
+// static/private
+template <typename Source>
+void witness::skip_data(Source& source, bool prefix) NOEXCEPT
+{
+    // Elements are skipped, not read (no allocation).
     if (prefix)
     {
         const auto count = source.read_size(max_block_weight);
 
         for (size_t element = 0; element < count; ++element)
-            source.read_bytes(source.read_size(max_block_weight));
+            source.skip_bytes(source.read_size(max_block_weight));
     }
     else
     {
         while (!source.is_exhausted())
-            source.read_bytes(source.read_size(max_block_weight));
+            source.skip_bytes(source.read_size(max_block_weight));
     }
 }
 
 // private
-void witness::assign_data(reader& source, bool prefix) NOEXCEPT
+template <typename Source>
+void witness::assign_data(Source& source, bool prefix) NOEXCEPT
 {
     size_ = zero;
-    auto& allocator = source.get_allocator();
+    byte_allocator& allocator = source.get_allocator();
 
     const auto push_witness = [&allocator, &source, this]() NOEXCEPT
     {
@@ -212,8 +239,7 @@ void witness::assign_data(reader& source, bool prefix) NOEXCEPT
 data_chunk witness::to_data(bool prefix) const NOEXCEPT
 {
     data_chunk data(serialized_size(prefix));
-    stream::out::fast ostream(data);
-    write::bytes::fast out(ostream);
+    write::bytes::slab out(data);
     to_data(out, prefix);
     return data;
 }
@@ -225,6 +251,23 @@ void witness::to_data(std::ostream& stream, bool prefix) const NOEXCEPT
 }
 
 void witness::to_data(writer& sink, bool prefix) const NOEXCEPT
+{
+    serialize(sink, prefix);
+}
+
+void witness::to_data(slab_writer& sink, bool prefix) const NOEXCEPT
+{
+    serialize(sink, prefix);
+}
+
+void witness::to_data(tee_writer& sink, bool prefix) const NOEXCEPT
+{
+    serialize(sink, prefix);
+}
+
+// private
+template <typename Sink>
+void witness::serialize(Sink& sink, bool prefix) const NOEXCEPT
 {
     // Witness prefix is an element count, not byte length (unlike script).
     if (prefix)
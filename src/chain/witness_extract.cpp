@@ -166,7 +166,8 @@ code witness::extract_segwit(script::cptr& out_script,
 // All [bip341] comments.
 // Extract script, initial execution stack, and optional tapleaf hash.
 code witness::extract_taproot(hash_cptr& out_leaf, script::cptr& out_script,
-    chunk_cptrs_ptr& out_stack, const script& program_script) const NOEXCEPT
+    chunk_cptrs_ptr& out_stack, const script& program_script,
+    const taproot::commitment* verified) const NOEXCEPT
 {
     BC_ASSERT(program_script.version() == script_version::taproot);
     const auto& program = program_script.witness_program();
@@ -198,7 +199,17 @@ code witness::extract_taproot(hash_cptr& out_leaf, script::cptr& out_script,
             {
                 const auto& key = unsafe_array_cast<uint8_t, ec_xonly_size>(
                     program->data());
-                
+
+                // Commitment of the key already verified (block batch).
+                if (!is_null(verified) && verified->valid &&
+                    verified->out_key == key)
+                {
+                    pop(*out_stack);
+                    out_script = verified->leaf_script;
+                    out_leaf = to_shared(verified->leaf);
+                    return error::script_success;
+                }
+
                 // The second-to-last stack element is the script.
                 out_script = to_shared<script>(*pop(*out_stack), false);
                 out_leaf = to_shared(taproot::leaf_hash(control.version(),
@@ -256,6 +267,42 @@ code witness::extract_taproot(hash_cptr& out_leaf, script::cptr& out_script,
     return error::script_success;
 }
 
+// All [bip341] comments.
+// Parse script-path spend as extract_taproot, deferring commitment checks.
+bool witness::extract_commitment(taproot::commitments& out_batch,
+    const script& program_script) const NOEXCEPT
+{
+    if (program_script.version() != script_version::taproot)
+        return false;
+
+    const auto& program = program_script.witness_program();
+    if (program->size() != ec_xonly_size)
+        return false;
+
+    // If at least two elements, discard annex if present.
+    auto stack_size = stack_.size();
+    if (annex::is_annex_pattern(stack_))
+        --stack_size;
+
+    // witness stack : <control> <script> [stack-elements]
+    if (stack_size <= one)
+        return false;
+
+    // The last stack element is the control block.
+    const tapscript control{ stack_.at(sub1(stack_size)) };
+    if (!control.is_valid() || !control.is_tapscript())
+        return false;
+
+    // The second-to-last stack element is the script.
+    const auto& key = unsafe_array_cast<uint8_t, ec_xonly_size>(
+        program->data());
+    const auto leaf_script = to_shared<script>(*stack_.at(stack_size - two),
+        false);
+    const auto leaf = taproot::leaf_hash(control.version(), *leaf_script);
+    out_batch.push_back({ control, key, leaf_script, leaf, false });
+    return true;
+}
+
 BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
 
 } // namespace chain
@@ -0,0 +1,179 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_CRYPTO_KEY_CACHE_HPP
+#define LIBBITCOIN_SYSTEM_CRYPTO_KEY_CACHE_HPP
+
+#include <atomic>
+#include <mutex>
+#include <random>
+#include <shared_mutex>
+#include <unordered_map>
+#include <bitcoin/system/crypto/secp256k1.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// Bounded thread safe map of serialized key to parsed key.
+/// Entries are distributed across independently locked shards, each of which
+/// evicts its oldest entry when full (parsed keys are never invalidated).
+/// Keys are hashed with a random per-process salt, as serialized keys are
+/// chosen by script authors and could otherwise be ground to collide.
+/// The Key type must be the exact serialized encoding (no padding), so that
+/// a cached key can never match a differently encoded key.
+template <typename Key, typename Value, size_t Shards = 16,
+    size_t Limit = 2048>
+class key_cache
+{
+public:
+    DELETE_COPY_MOVE(key_cache);
+
+    key_cache() NOEXCEPT = default;
+
+    /// Copy the parsed key to out if cached.
+    bool find(Value& out, const Key& key) const NOEXCEPT
+    {
+        const auto hashed = to_hashed(key);
+        const auto& shard = shards_[shard_index(hashed)];
+        {
+            std::shared_lock lock(shard.mutex);
+            const auto it = shard.map.find(hashed);
+            if (it != shard.map.end())
+            {
+                out = it->second;
+                hits_.fetch_add(one, std::memory_order_relaxed);
+                return true;
+            }
+        }
+
+        misses_.fetch_add(one, std::memory_order_relaxed);
+        return false;
+    }
+
+    /// Cache the parsed key, evicting the shard's oldest entry if full.
+    void emplace(const Key& key, const Value& value) NOEXCEPT
+    {
+        const auto hashed = to_hashed(key);
+        auto& shard = shards_[shard_index(hashed)];
+        std::unique_lock lock(shard.mutex);
+
+        BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+        if (!shard.map.emplace(hashed, value).second)
+            return;
+
+        if (shard.order.size() < Limit)
+        {
+            shard.order.push_back(hashed);
+            return;
+        }
+
+        shard.map.erase(shard.order[shard.next]);
+        BC_POP_WARNING()
+
+        shard.order[shard.next] = hashed;
+        shard.next = (add1(shard.next) % Limit);
+    }
+
+    /// Cache statistics (counts are not synchronized with each other).
+    key_cache_statistics statistics() const NOEXCEPT
+    {
+        size_t size{};
+        for (const auto& shard: shards_)
+        {
+            std::shared_lock lock(shard.mutex);
+            size += shard.map.size();
+        }
+
+        return
+        {
+            hits_.load(std::memory_order_relaxed),
+            misses_.load(std::memory_order_relaxed),
+            size
+        };
+    }
+
+private:
+    static siphash_key make_salt() NOEXCEPT
+    {
+        BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+        std::random_device device{};
+        std::uniform_int_distribution<uint64_t> distribution{};
+        return { distribution(device), distribution(device) };
+        BC_POP_WARNING()
+    }
+
+    static const siphash_key& salt() NOEXCEPT
+    {
+        static const auto key = make_salt();
+        return key;
+    }
+
+    // The salted hash is computed once per call and stored with the key, so
+    // shard selection, bucket lookup and eviction do not rehash the key.
+    struct hashed_key
+    {
+        Key key;
+        uint64_t hash;
+
+        bool operator==(const hashed_key& other) const NOEXCEPT
+        {
+            return hash == other.hash && key == other.key;
+        }
+    };
+
+    struct key_hash
+    {
+        size_t operator()(const hashed_key& key) const NOEXCEPT
+        {
+            return possible_narrow_cast<size_t>(key.hash);
+        }
+    };
+
+    static hashed_key to_hashed(const Key& key) NOEXCEPT
+    {
+        return { key, siphash(salt(), key) };
+    }
+
+    // Shards use the high bits, buckets within a shard use the low bits.
+    static size_t shard_index(const hashed_key& key) NOEXCEPT
+    {
+        return possible_narrow_cast<size_t>(
+            shift_right(key.hash, 32u) % Shards);
+    }
+
+    struct shard
+    {
+        mutable std::shared_mutex mutex{};
+        std::unordered_map<hashed_key, Value, key_hash> map{};
+        std_vector<hashed_key> order{};
+        size_t next{};
+    };
+
+    std::array<shard, Shards> shards_{};
+    mutable std::atomic<uint64_t> hits_{};
+    mutable std::atomic<uint64_t> misses_{};
+};
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -28,6 +28,7 @@
 #include <bitcoin/system/hash/hash.hpp>
 #include <bitcoin/system/math/math.hpp>
 #include "ec_context.hpp"
+#include "key_cache.hpp"
 
 namespace libbitcoin {
 namespace system {
@@ -426,16 +427,64 @@ bool sign(ec_signature& out, const ec_secret& secret,
         secp256k1_nonce_function_rfc6979, nullptr) == ec_success;
 }
 
+// Each encoding size has its own cache, keyed by its exact serialization.
+static key_cache<ec_compressed, secp256k1_pubkey> compressed_cache{};
+static key_cache<ec_uncompressed, secp256k1_pubkey> uncompressed_cache{};
+
+template <typename Key>
+static bool parse_cached(key_cache<Key, secp256k1_pubkey>& cache,
+    const secp256k1_context* context, secp256k1_pubkey& out,
+    const data_slice& point) NOEXCEPT
+{
+    const auto& key = unsafe_array_cast<uint8_t, array_count<Key>>(
+        point.data());
+
+    if (cache.find(out, key))
+        return true;
+
+    if (!system::parse(context, out, point))
+        return false;
+
+    cache.emplace(key, out);
+    return true;
+}
+
 bool verify_signature(const data_slice& point, const hash_digest& hash,
     const ec_signature& signature) NOEXCEPT
 {
     secp256k1_pubkey pubkey;
     const auto context = ec_context_verify::context();
 
-    return system::parse(context, pubkey, point) &&
+    // Only parseable sizes are cached, others are rejected by parse.
+    bool parsed{};
+    switch (point.size())
+    {
+        case ec_compressed_size:
+            parsed = parse_cached(compressed_cache, context, pubkey, point);
+            break;
+        case ec_uncompressed_size:
+            parsed = parse_cached(uncompressed_cache, context, pubkey, point);
+            break;
+        default:
+            parsed = system::parse(context, pubkey, point);
+    }
+
+    return parsed &&
         system::verify_signature(context, pubkey, hash, signature);
 }
 
+key_cache_statistics cache_statistics() NOEXCEPT
+{
+    const auto compressed = compressed_cache.statistics();
+    const auto uncompressed = uncompressed_cache.statistics();
+    return
+    {
+        compressed.hits + uncompressed.hits,
+        compressed.misses + uncompressed.misses,
+        compressed.size + uncompressed.size
+    };
+}
+
 // ECDSA recoverable sign/recover
 // ----------------------------------------------------------------------------
 // It is recommended to verify a signature after signing.
@@ -475,6 +524,38 @@ bool recover_public(ec_uncompressed& out,
     return recover_public(context, out, recoverable, hash);
 }
 
+bool recover_candidates(uncompressed_list& out, const ec_signature& signature,
+    const hash_digest& hash) NOEXCEPT
+{
+    const auto context = ec_context_verify::context();
+    const auto parsed = pointer_cast<const secp256k1_ecdsa_signature>(
+        signature.data());
+
+    // Recovery from (r, s) and (r, n - s) produces the same points (with the
+    // opposite R parity), so normalization is unnecessary when all recovery
+    // ids are attempted. Overflowed or zero r/s recover no points, just as
+    // such signatures verify against no point.
+    recoverable_signature recoverable{};
+    if (secp256k1_ecdsa_signature_serialize_compact(context,
+        recoverable.signature.data(), parsed) != ec_success)
+        return false;
+
+    out.clear();
+    ec_uncompressed point{};
+    for (auto id = 0; id <= maximum_recovery_id; ++id)
+    {
+        recoverable.recovery_id = narrow_sign_cast<uint8_t>(id);
+        if (recover_public(context, point, recoverable, hash))
+        {
+            BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+            out.push_back(point);
+            BC_POP_WARNING()
+        }
+    }
+
+    return true;
+}
+
 } // namespace ecdsa
 
 namespace schnorr {
@@ -508,6 +589,8 @@ bool verify_signature(const data_chunk& x_point, const hash_digest& hash,
     return verify_signature(pubkey, hash, signature);
 }
 
+static key_cache<ec_xonly, secp256k1_xonly_pubkey> x_point_cache{};
+
 // BIP341: A Taproot signature is a 64-byte Schnorr sig, as defined in BIP340.
 bool verify_signature(const ec_xonly& x_point, const hash_digest& hash,
     const ec_signature& signature) NOEXCEPT
@@ -515,11 +598,22 @@ bool verify_signature(const ec_xonly& x_point, const hash_digest& hash,
     secp256k1_xonly_pubkey pubkey;
     const auto context = ec_context_verify::context();
 
-    return
-        secp256k1_xonly_pubkey_parse(context, &pubkey, x_point.data()) ==
-            ec_success && 
-        secp256k1_schnorrsig_verify(context, signature.data(), hash.data(),
-            hash_size, &pubkey) == ec_success;
+    if (!x_point_cache.find(pubkey, x_point))
+    {
+        if (secp256k1_xonly_pubkey_parse(context, &pubkey, x_point.data()) !=
+            ec_success)
+            return false;
+
+        x_point_cache.emplace(x_point, pubkey);
+    }
+
+    return secp256k1_schnorrsig_verify(context, signature.data(), hash.data(),
+        hash_size, &pubkey) == ec_success;
+}
+
+key_cache_statistics cache_statistics() NOEXCEPT
+{
+    return x_point_cache.statistics();
 }
 
 // BIP341: If q != x(Q) or c[0] & 1 != y(Q) mod 2, fail.
@@ -215,6 +215,10 @@ DEFINED("HAVE_EXECUTION")
 DEFINED("HAVE_ICU")
 #endif
 
+#ifdef HAVE_PROFILE
+DEFINED("HAVE_PROFILE")
+#endif
+
 // These messages are suppressed without this.
 #ifdef HAVE_MESSAGES
 DEFINED("HAVE_MESSAGES")
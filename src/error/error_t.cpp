@@ -29,7 +29,8 @@ DEFINE_ERROR_T_MESSAGE_MAP(error)
 {
     { success, "success" },
     { not_found, "object does not exist" },
-    { not_implemented, "feature not implemented" }
+    { not_implemented, "feature not implemented" },
+    { invalid_frame, "invalid framed object" }
     ////{ error_last, "unmapped code" }
 };
 
@@ -22,7 +22,9 @@
 #include <bitcoin/system/filter/golomb.hpp>
 
 #include <algorithm>
+#include <array>
 #include <utility>
+#include <vector>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/hash/hash.hpp>
@@ -32,6 +34,47 @@
 namespace libbitcoin {
 namespace system {
 
+BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+
+// local
+// LSD radix sort on a 64 bit key, a byte per pass. A pass in which all keys
+// share one digit (typical of the high bytes of small ranges) is skipped.
+template <typename Item, typename Key>
+static void radix_sort(std::vector<Item>& items, Key&& key) NOEXCEPT
+{
+    constexpr auto radix = power2(byte_bits);
+    const auto count = items.size();
+    if (count < two)
+        return;
+
+    std::vector<Item> buffer(count);
+    for (size_t shift = 0; shift < bits<uint64_t>; shift += byte_bits)
+    {
+        const auto digit = [&](const Item& item) NOEXCEPT
+        {
+            return narrow_cast<uint8_t>(shift_right(key(item), shift));
+        };
+
+        std::array<size_t, radix> offsets{};
+        for (const auto& item: items)
+            ++offsets[digit(item)];
+
+        if (offsets[digit(items.front())] == count)
+            continue;
+
+        size_t offset = 0;
+        for (auto& bucket: offsets)
+            bucket = std::exchange(offset, offset + bucket);
+
+        for (const auto& item: items)
+            buffer[offsets[digit(item)]++] = item;
+
+        std::swap(items, buffer);
+    }
+}
+
+BC_POP_WARNING()
+
 // Golomb-coded set construction
 // ----------------------------------------------------------------------------
 
@@ -39,15 +82,14 @@ namespace system {
 void golomb::construct(bitwriter& writer, const data_stack& items, uint8_t bits,
     const siphash_key& entropy, uint64_t target_false_positive_rate) NOEXCEPT
 {
-    const auto set = hashed_set_construct(items, items.size(),
-        target_false_positive_rate, entropy);
+    encode_set(writer, items, bits, entropy, target_false_positive_rate);
+}
 
-    uint64_t previous = 0;
-    for (const auto value: set)
-    {
-        encode(writer, value - previous, bits);
-        previous = value;
-    };
+void golomb::construct(word_bit_writer& writer, const data_stack& items,
+    uint8_t bits, const siphash_key& entropy,
+    uint64_t target_false_positive_rate) NOEXCEPT
+{
+    encode_set(writer, items, bits, entropy, target_false_positive_rate);
 }
 
 data_chunk golomb::construct(const data_stack& items, uint8_t bits,
@@ -55,9 +97,8 @@ data_chunk golomb::construct(const data_stack& items, uint8_t bits,
 {
     data_chunk out{};
 
-    // A vector (push) stream is used because the size is not known a-priori.
-    stream::out::data stream(out);
-    write::bits::ostream writer(stream);
+    // A vector sink is used because the size is not known a-priori.
+    write::bits::word writer(out);
     construct(writer, items, bits, entropy, target_false_positive_rate);
     writer.flush();
     return out;
@@ -70,6 +111,53 @@ data_chunk golomb::construct(const data_stack& items, uint8_t bits,
         target_false_positive_rate);
 }
 
+void golomb::construct(word_bit_writer& writer,
+    const std::vector<uint64_t>& set, uint8_t bits) NOEXCEPT
+{
+    encode_sorted(writer, set, bits);
+}
+
+std::vector<uint64_t> golomb::distinct_set(const std::vector<data_slice>& items,
+    const siphash_key& entropy, uint64_t target_false_positive_rate) NOEXCEPT
+{
+    // Hashing is independent of set size, so precedes deduplication.
+    std::vector<uint64_t> hashes{};
+    siphash(hashes, entropy, items);
+
+    // Each hash is paired with its item, as distinct items may collide.
+    std::vector<std::pair<uint64_t, size_t>> keyed(hashes.size());
+    for (size_t index = 0; index < hashes.size(); ++index)
+        keyed[index] = { hashes[index], index };
+
+    radix_sort(keyed, [](const auto& pair) NOEXCEPT { return pair.first; });
+
+    // Only byte-equal items within a run of equal hashes are duplicates.
+    hashes.clear();
+    for (auto run = keyed.begin(); run != keyed.end();)
+    {
+        const auto end = std::find_if(run, keyed.end(),
+            [&](const auto& pair) NOEXCEPT { return pair.first != run->first; });
+
+        for (auto it = run; it != end; ++it)
+            if (std::none_of(run, it, [&](const auto& prior) NOEXCEPT
+                { return items[prior.second] == items[it->second]; }))
+                hashes.push_back(it->first);
+
+        run = end;
+    }
+
+    const auto size = hashes.size();
+    if (is_multiply_overflow(target_false_positive_rate, size))
+        return {};
+
+    // Mapping to range is monotonic, so sorted hashes remain sorted.
+    const auto bound = target_false_positive_rate * size;
+    for (auto& hash: hashes)
+        hash = to_range(hash, bound);
+
+    return hashes;
+}
+
 // Single element match
 // ----------------------------------------------------------------------------
 
@@ -78,32 +166,23 @@ bool golomb::match_single(bitreader& reader, const data_chunk& target,
     uint64_t set_size, const siphash_key& entropy, uint8_t bits,
     uint64_t target_false_positive_rate) NOEXCEPT
 {
-    const auto bound = target_false_positive_rate * set_size;
-    const auto range = hash_to_range(target, bound, entropy);
-
-    uint64_t previous = 0;
-    for (uint64_t index = 0; index < set_size; index++)
-    {
-        const auto value = previous + decode(reader, bits);
-
-        if (value == range)
-            return true;
-
-        if (value > range)
-            break;
-
-        previous = value;
-    }
+    return find_single(reader, target, set_size, entropy, bits,
+        target_false_positive_rate);
+}
 
-    return false;
+bool golomb::match_single(word_bit_reader& reader, const data_chunk& target,
+    uint64_t set_size, const siphash_key& entropy, uint8_t bits,
+    uint64_t target_false_positive_rate) NOEXCEPT
+{
+    return find_single(reader, target, set_size, entropy, bits,
+        target_false_positive_rate);
 }
 
 bool golomb::match_single(const data_chunk& compressed_set,
     const data_chunk& target,  uint64_t set_size, const siphash_key& entropy,
     uint8_t bits, uint64_t target_false_positive_rate) NOEXCEPT
 {
-    stream::in::fast source(compressed_set);
-    read::bits::fast reader(source);
+    read::bits::word reader(compressed_set);
     return match_single(reader, target, set_size, entropy, bits,
         target_false_positive_rate);
 }
@@ -120,42 +199,27 @@ bool golomb::match_single(const data_chunk& compressed_set,
 // ----------------------------------------------------------------------------
 
 // protected
-bool golomb::match_stack(bitreader& source, const data_stack& targets,
+bool golomb::match_stack(bitreader& reader, const data_stack& targets,
     uint64_t set_size, const siphash_key& entropy, uint8_t bits,
     uint64_t target_false_positive_rate) NOEXCEPT
 {
-    if (targets.empty())
-        return false;
-
-    const auto set = hashed_set_construct(targets, set_size,
-        target_false_positive_rate, entropy);
-
-    uint64_t range = 0;
-    auto it = set.begin();
-
-    for (uint64_t index = 0; index < set_size && it != set.end(); ++index)
-    {
-        range += decode(source, bits);
-
-        for (auto value = *it; it != set.end(); value = *(it++))
-        {
-            if (value == range)
-                return true;
-
-            if (value > range)
-                break;
-        }
-    }
+    return find_stack(reader, targets, set_size, entropy, bits,
+        target_false_positive_rate);
+}
 
-    return false;
+bool golomb::match_stack(word_bit_reader& reader, const data_stack& targets,
+    uint64_t set_size, const siphash_key& entropy, uint8_t bits,
+    uint64_t target_false_positive_rate) NOEXCEPT
+{
+    return find_stack(reader, targets, set_size, entropy, bits,
+        target_false_positive_rate);
 }
 
 bool golomb::match_stack(const data_chunk& compressed_set,
     const data_stack& targets, uint64_t set_size, const siphash_key& entropy,
     uint8_t bits, uint64_t target_false_positive_rate) NOEXCEPT
 {
-    stream::in::fast source(compressed_set);
-    read::bits::fast reader(source);
+    read::bits::word reader(compressed_set);
     return match_stack(reader, targets, set_size, entropy, bits,
         target_false_positive_rate);
 }
@@ -171,6 +235,85 @@ bool golomb::match_stack(const data_chunk& compressed_set,
 // private
 // ----------------------------------------------------------------------------
 
+template <typename Writer>
+void golomb::encode_set(Writer& writer, const data_stack& items,
+    uint8_t bits, const siphash_key& entropy,
+    uint64_t target_false_positive_rate) NOEXCEPT
+{
+    encode_sorted(writer, hashed_set_construct(items, items.size(),
+        target_false_positive_rate, entropy), bits);
+}
+
+template <typename Writer>
+void golomb::encode_sorted(Writer& writer, const std::vector<uint64_t>& set,
+    uint8_t bits) NOEXCEPT
+{
+    uint64_t previous = 0;
+    for (const auto value: set)
+    {
+        encode(writer, value - previous, bits);
+        previous = value;
+    };
+}
+
+template <typename Reader>
+bool golomb::find_single(Reader& reader, const data_chunk& target,
+    uint64_t set_size, const siphash_key& entropy, uint8_t bits,
+    uint64_t target_false_positive_rate) NOEXCEPT
+{
+    const auto bound = target_false_positive_rate * set_size;
+    const auto range = hash_to_range(target, bound, entropy);
+
+    uint64_t previous = 0;
+    for (uint64_t index = 0; index < set_size; index++)
+    {
+        const auto value = previous + decode(reader, bits);
+
+        if (value == range)
+            return true;
+
+        if (value > range)
+            break;
+
+        previous = value;
+    }
+
+    return false;
+}
+
+template <typename Reader>
+bool golomb::find_stack(Reader& source, const data_stack& targets,
+    uint64_t set_size, const siphash_key& entropy, uint8_t bits,
+    uint64_t target_false_positive_rate) NOEXCEPT
+{
+    if (targets.empty())
+        return false;
+
+    const auto set = hashed_set_construct(targets, set_size,
+        target_false_positive_rate, entropy);
+
+    if (set.empty())
+        return false;
+
+    // Merge the sorted targets against the decoded set, exit on first match.
+    uint64_t range = 0;
+    auto it = set.begin();
+
+    for (uint64_t index = 0; index < set_size; ++index)
+    {
+        range += decode(source, bits);
+
+        while (*it < range)
+            if (++it == set.end())
+                return false;
+
+        if (*it == range)
+            return true;
+    }
+
+    return false;
+}
+
 void golomb::encode(bitwriter& writer, uint64_t value,
     uint8_t modulo_exponent) NOEXCEPT
 {
@@ -182,6 +325,14 @@ void golomb::encode(bitwriter& writer, uint64_t value,
     writer.write_bits(value, modulo_exponent);
 }
 
+void golomb::encode(word_bit_writer& writer, uint64_t value,
+    uint8_t modulo_exponent) NOEXCEPT
+{
+    // The unary quotient is written by word, not by bit.
+    writer.write_unary(shift_right(value, modulo_exponent));
+    writer.write_bits(value, modulo_exponent);
+}
+
 uint64_t golomb::decode(bitreader& reader, uint8_t modulo_exponent) NOEXCEPT
 {
     uint64_t quotient = 0;
@@ -192,11 +343,25 @@ uint64_t golomb::decode(bitreader& reader, uint8_t modulo_exponent) NOEXCEPT
     return shift_left(quotient, modulo_exponent) + remainder;
 }
 
+uint64_t golomb::decode(word_bit_reader& reader,
+    uint8_t modulo_exponent) NOEXCEPT
+{
+    // The unary quotient is counted by leading ones, the remainder by shift.
+    const auto quotient = reader.read_unary();
+    const auto remainder = reader.read_bits(modulo_exponent);
+    return shift_left(quotient, modulo_exponent) + remainder;
+}
+
 uint64_t golomb::hash_to_range(const data_slice& item, uint64_t bound,
     const siphash_key& key) NOEXCEPT
+{
+    return to_range(siphash(key, item), bound);
+}
+
+uint64_t golomb::to_range(uint64_t hash, uint64_t bound) NOEXCEPT
 {
     constexpr auto shift = bits<uint64_t>;
-    const auto product = uint128_t(siphash(key, item)) * uint128_t(bound);
+    const auto product = uint128_t(hash) * uint128_t(bound);
     return (product >> shift).convert_to<uint64_t>();
 }
 
@@ -207,17 +372,19 @@ std::vector<uint64_t> golomb::hashed_set_construct(const data_stack& items,
     if (is_multiply_overflow(target_false_positive_rate, set_size))
         return {};
 
-    std::vector<uint64_t> hashes(items.size());
+    // All items are hashed under the one key as a batch.
+    std::vector<uint64_t> hashes{};
+    siphash(hashes, key, items);
+
     const auto bound = target_false_positive_rate * set_size;
-    std::transform(items.begin(), items.end(), hashes.begin(),
-        [&](const data_chunk& item) NOEXCEPT
-        {
-            return hash_to_range(item, bound, key);
-        });
+    std::for_each(hashes.begin(), hashes.end(), [=](uint64_t& hash) NOEXCEPT
+    {
+        hash = to_range(hash, bound);
+    });
 
-    return sort(std::move(hashes));
+    radix_sort(hashes, [](uint64_t hash) NOEXCEPT { return hash; });
+    return hashes;
 }
 
-
 } // namespace system
 } // namespace libbitcoin
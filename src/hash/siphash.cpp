@@ -21,15 +21,16 @@
 
 #include <bitcoin/system/hash/siphash.hpp>
 
+#include <algorithm>
+#include <array>
+#include <iterator>
 #include <tuple>
+#include <vector>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/math/math.hpp>
 #include <bitcoin/system/endian/endian.hpp>
 
-// This would be circular a /hash include (must stay in cpp).
-#include <bitcoin/system/stream/stream.hpp>
-
 namespace libbitcoin {
 namespace system {
 
@@ -73,28 +74,40 @@ constexpr void compression_round(uint64_t& v0, uint64_t& v1, uint64_t& v2,
     v0 ^= word;
 }
 
-uint64_t siphash(const siphash_key& key, const data_slice& message) NOEXCEPT
+// local
+inline uint64_t last_word(const uint8_t* data, size_t bytes) NOEXCEPT
 {
-    auto v0 = siphash_magic_0 ^ std::get<0>(key);
-    auto v1 = siphash_magic_1 ^ std::get<1>(key);
-    auto v2 = siphash_magic_2 ^ std::get<0>(key);
-    auto v3 = siphash_magic_3 ^ std::get<1>(key);
+    BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+    constexpr auto eight = sizeof(uint64_t);
+    const auto whole = bytes - (bytes % eight);
+
+    // Copy zero to seven remainder bytes (zero padded).
+    data_array<eight> remainder{};
+    std::copy(std::next(data, whole), std::next(data, bytes),
+        remainder.begin());
+    BC_POP_WARNING()
 
+    auto last = from_little_endian(remainder);
+    last ^= ((bytes % max_encoded_byte_count) << to_bits(sub1(eight)));
+    return last;
+}
+
+// local
+inline uint64_t digest(uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3,
+    const data_slice& message) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
     constexpr auto eight = sizeof(uint64_t);
     const auto bytes = message.size();
-    stream::in::fast stream(message);
-    read::bytes::fast source(stream);
-
-    for (size_t index = eight; index <= bytes; index += eight)
-        compression_round(v0, v1, v2, v3, source.read_8_bytes_little_endian());
+    const auto whole = bytes - (bytes % eight);
+    const auto data = message.data();
 
-    // Read zero to seven remainder bytes (zero padded, fails stream).
-    BC_ASSERT(source);
-    auto last = source.read_8_bytes_little_endian();
-    BC_ASSERT(!source);
+    for (size_t index = 0; index < whole; index += eight)
+        compression_round(v0, v1, v2, v3,
+            unsafe_from_little_endian<uint64_t>(std::next(data, index)));
+    BC_POP_WARNING()
 
-    last ^= ((bytes % max_encoded_byte_count) << to_bits(sub1(eight)));
-    compression_round(v0, v1, v2, v3, last);
+    compression_round(v0, v1, v2, v3, last_word(data, bytes));
 
     v2 ^= finalization;
     sip_round(v0, v1, v2, v3);
@@ -105,6 +118,177 @@ uint64_t siphash(const siphash_key& key, const data_slice& message) NOEXCEPT
     return v0 ^ v1 ^ v2 ^ v3;
 }
 
+uint64_t siphash(const siphash_key& key, const data_slice& message) NOEXCEPT
+{
+    const auto v0 = siphash_magic_0 ^ std::get<0>(key);
+    const auto v1 = siphash_magic_1 ^ std::get<1>(key);
+    const auto v2 = siphash_magic_2 ^ std::get<0>(key);
+    const auto v3 = siphash_magic_3 ^ std::get<1>(key);
+    return digest(v0, v1, v2, v3, message);
+}
+
+// Batch.
+// ----------------------------------------------------------------------------
+// Messages are hashed in groups of independent lanes. Each step of a round is
+// applied across all lanes before the next step, so the dependency chains of
+// the lanes interleave (and vectorize where the target supports it).
+
+constexpr size_t lanes = 4;
+typedef std::array<uint64_t, lanes> lane_words;
+
+// local
+constexpr void sip_round(lane_words& v0, lane_words& v1, lane_words& v2,
+    lane_words& v3) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+    for (size_t lane = 0; lane < lanes; ++lane)
+    {
+        v0[lane] += v1[lane];
+        v2[lane] += v3[lane];
+    }
+
+    for (size_t lane = 0; lane < lanes; ++lane)
+    {
+        rotate_left_into(v1[lane], 13);
+        rotate_left_into(v3[lane], 16);
+    }
+
+    for (size_t lane = 0; lane < lanes; ++lane)
+    {
+        v1[lane] ^= v0[lane];
+        v3[lane] ^= v2[lane];
+        rotate_left_into(v0[lane], 32);
+    }
+
+    for (size_t lane = 0; lane < lanes; ++lane)
+    {
+        v2[lane] += v1[lane];
+        v0[lane] += v3[lane];
+    }
+
+    for (size_t lane = 0; lane < lanes; ++lane)
+    {
+        rotate_left_into(v1[lane], 17);
+        rotate_left_into(v3[lane], 21);
+    }
+
+    for (size_t lane = 0; lane < lanes; ++lane)
+    {
+        v1[lane] ^= v2[lane];
+        v3[lane] ^= v0[lane];
+        rotate_left_into(v2[lane], 32);
+    }
+    BC_POP_WARNING()
+}
+
+// local
+constexpr void compression_round(lane_words& v0, lane_words& v1,
+    lane_words& v2, lane_words& v3, const lane_words& words) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+    for (size_t lane = 0; lane < lanes; ++lane)
+        v3[lane] ^= words[lane];
+
+    sip_round(v0, v1, v2, v3);
+    sip_round(v0, v1, v2, v3);
+
+    for (size_t lane = 0; lane < lanes; ++lane)
+        v0[lane] ^= words[lane];
+    BC_POP_WARNING()
+}
+
+// local
+template <typename Message>
+inline void digests(uint64_t* out, const siphash_key& key,
+    const Message* messages) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+    BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+    constexpr auto eight = sizeof(uint64_t);
+    lane_words v0{}, v1{}, v2{}, v3{}, words{};
+    std::array<size_t, lanes> whole{};
+    auto common = max_size_t;
+
+    for (size_t lane = 0; lane < lanes; ++lane)
+    {
+        const auto bytes = messages[lane].size();
+        v0[lane] = siphash_magic_0 ^ std::get<0>(key);
+        v1[lane] = siphash_magic_1 ^ std::get<1>(key);
+        v2[lane] = siphash_magic_2 ^ std::get<0>(key);
+        v3[lane] = siphash_magic_3 ^ std::get<1>(key);
+        whole[lane] = bytes - (bytes % eight);
+        common = std::min(common, whole[lane]);
+    }
+
+    // Compress the whole words common to all lanes together.
+    for (size_t index = 0; index < common; index += eight)
+    {
+        for (size_t lane = 0; lane < lanes; ++lane)
+            words[lane] = unsafe_from_little_endian<uint64_t>(
+                std::next(messages[lane].data(), index));
+
+        compression_round(v0, v1, v2, v3, words);
+    }
+
+    // Compress whole words beyond the shortest message lane by lane.
+    for (size_t lane = 0; lane < lanes; ++lane)
+    {
+        const auto data = messages[lane].data();
+        for (auto index = common; index < whole[lane]; index += eight)
+            compression_round(v0[lane], v1[lane], v2[lane], v3[lane],
+                unsafe_from_little_endian<uint64_t>(std::next(data, index)));
+
+        words[lane] = last_word(data, messages[lane].size());
+    }
+
+    compression_round(v0, v1, v2, v3, words);
+
+    for (size_t lane = 0; lane < lanes; ++lane)
+        v2[lane] ^= finalization;
+
+    sip_round(v0, v1, v2, v3);
+    sip_round(v0, v1, v2, v3);
+    sip_round(v0, v1, v2, v3);
+    sip_round(v0, v1, v2, v3);
+
+    for (size_t lane = 0; lane < lanes; ++lane)
+        out[lane] = v0[lane] ^ v1[lane] ^ v2[lane] ^ v3[lane];
+    BC_POP_WARNING()
+    BC_POP_WARNING()
+}
+
+// local
+template <typename Messages>
+static void batch(std::vector<uint64_t>& out, const siphash_key& key,
+    const Messages& messages) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+    const auto count = messages.size();
+    const auto grouped = count - (count % lanes);
+    out.resize(count);
+
+    for (size_t index = 0; index < grouped; index += lanes)
+        digests(std::next(out.data(), index), key,
+            std::next(messages.data(), index));
+    BC_POP_WARNING()
+
+    // Remaining messages are hashed individually.
+    for (auto index = grouped; index < count; ++index)
+        out.at(index) = siphash(key, messages.at(index));
+}
+
+void siphash(std::vector<uint64_t>& out, const siphash_key& key,
+    const data_stack& messages) NOEXCEPT
+{
+    batch(out, key, messages);
+}
+
+void siphash(std::vector<uint64_t>& out, const siphash_key& key,
+    const std::vector<data_slice>& messages) NOEXCEPT
+{
+    batch(out, key, messages);
+}
+
 uint64_t siphash(const half_hash& hash, const data_slice& message) NOEXCEPT
 {
     return siphash(to_siphash_key(hash), message);
@@ -0,0 +1,238 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/machine/profiler.hpp>
+
+#if defined(HAVE_PROFILE)
+
+#include <atomic>
+#include <chrono>
+#include <sstream>
+#include <utility>
+#include <bitcoin/system/chain/chain.hpp>
+#include <bitcoin/system/define.hpp>
+
+#if defined(HAVE_XCPU)
+    #if defined(HAVE_MSC)
+        #include <intrin.h>
+    #else
+        #include <x86intrin.h>
+    #endif
+#endif
+
+namespace libbitcoin {
+namespace system {
+namespace machine {
+
+// Each connect is evaluated on a single thread, so the profiler is passed to
+// the interpreter by thread (avoids threading it through program construct).
+static thread_local profiler* current_{};
+
+constexpr auto relaxed = std::memory_order_relaxed;
+
+// static
+uint64_t profiler::now() NOEXCEPT
+{
+#if defined(HAVE_XCPU)
+    return __rdtsc();
+#else
+    return possible_narrow_sign_cast<uint64_t>(
+        std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+// static
+profiler* profiler::current() NOEXCEPT
+{
+    return current_;
+}
+
+profiler::profiler() NOEXCEPT
+  : tracer_{}
+{
+}
+
+profiler::profiler(tracer&& trace) NOEXCEPT
+  : tracer_{ std::move(trace) }
+{
+}
+
+// Recording.
+// ----------------------------------------------------------------------------
+
+void profiler::op(chain::opcode code, uint64_t cycles) NOEXCEPT
+{
+    const auto index = static_cast<uint8_t>(code);
+    counts_[index].fetch_add(one, relaxed);
+    cycles_[index].fetch_add(cycles, relaxed);
+}
+
+void profiler::input(standard type, uint64_t cycles) NOEXCEPT
+{
+    const auto index = static_cast<size_t>(type);
+    standard_counts_[index].fetch_add(one, relaxed);
+    standard_cycles_[index].fetch_add(cycles, relaxed);
+}
+
+void profiler::depth(size_t depth) NOEXCEPT
+{
+    auto maximum = max_depth_.load(relaxed);
+    while (depth > maximum &&
+        !max_depth_.compare_exchange_weak(maximum, depth, relaxed));
+}
+
+void profiler::record(event type, uint64_t cycles) NOEXCEPT
+{
+    switch (type)
+    {
+        case event::sighash:
+            sighashes_.fetch_add(one, relaxed);
+            sighash_cycles_.fetch_add(cycles, relaxed);
+            return;
+        case event::verify:
+            verifies_.fetch_add(one, relaxed);
+            verify_cycles_.fetch_add(cycles, relaxed);
+            return;
+    }
+}
+
+void profiler::trace(const chain::operation& op, size_t depth) const NOEXCEPT
+{
+    if (tracer_)
+        tracer_(op, depth);
+}
+
+// Reporting.
+// ----------------------------------------------------------------------------
+
+profiler::report profiler::snapshot() const NOEXCEPT
+{
+    report out{};
+    for (size_t index = 0; index < report::opcodes; ++index)
+    {
+        out.counts[index] = counts_[index].load(relaxed);
+        out.cycles[index] = cycles_[index].load(relaxed);
+    }
+
+    for (size_t index = 0; index < report::standards; ++index)
+    {
+        out.standard_counts[index] = standard_counts_[index].load(relaxed);
+        out.standard_cycles[index] = standard_cycles_[index].load(relaxed);
+    }
+
+    out.max_depth = max_depth_.load(relaxed);
+    out.sighashes = sighashes_.load(relaxed);
+    out.sighash_cycles = sighash_cycles_.load(relaxed);
+    out.verifies = verifies_.load(relaxed);
+    out.verify_cycles = verify_cycles_.load(relaxed);
+    return out;
+}
+
+void profiler::reset() NOEXCEPT
+{
+    for (size_t index = 0; index < report::opcodes; ++index)
+    {
+        counts_[index].store(zero, relaxed);
+        cycles_[index].store(zero, relaxed);
+    }
+
+    for (size_t index = 0; index < report::standards; ++index)
+    {
+        standard_counts_[index].store(zero, relaxed);
+        standard_cycles_[index].store(zero, relaxed);
+    }
+
+    max_depth_.store(zero, relaxed);
+    sighashes_.store(zero, relaxed);
+    sighash_cycles_.store(zero, relaxed);
+    verifies_.store(zero, relaxed);
+    verify_cycles_.store(zero, relaxed);
+}
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+std::string profiler::report::to_string() const NOEXCEPT
+{
+    using namespace chain;
+    std::ostringstream out{};
+    for (size_t index = 0; index < opcodes; ++index)
+    {
+        if (is_zero(counts[index]))
+            continue;
+
+        const auto code = static_cast<opcode>(index);
+        out << opcode_to_mnemonic(code, flags::all_rules) << "\t"
+            << counts[index] << "\t" << cycles[index] << "\n";
+    }
+
+    static const std::array<std::string, standards> names
+    {
+        "[key_hash]", "[witness_key_hash]", "[taproot_key]"
+    };
+
+    for (size_t index = 0; index < standards; ++index)
+    {
+        if (is_zero(standard_counts[index]))
+            continue;
+
+        out << names[index] << "\t" << standard_counts[index] << "\t"
+            << standard_cycles[index] << "\n";
+    }
+
+    out << "max_depth\t" << max_depth << "\n"
+        << "sighash\t" << sighashes << "\t" << sighash_cycles << "\n"
+        << "verify\t" << verifies << "\t" << verify_cycles << "\n";
+
+    return out.str();
+}
+
+BC_POP_WARNING()
+
+// scope
+// ----------------------------------------------------------------------------
+
+profiler::scope::scope(profiler* instance) NOEXCEPT
+  : previous_(current_)
+{
+    current_ = instance;
+}
+
+profiler::scope::~scope() NOEXCEPT
+{
+    current_ = previous_;
+}
+
+// timer
+// ----------------------------------------------------------------------------
+
+profiler::timer::timer(event type) NOEXCEPT
+  : profiler_(current_), type_(type), start_(is_null(current_) ? zero : now())
+{
+}
+
+profiler::timer::~timer() NOEXCEPT
+{
+    if (!is_null(profiler_))
+        profiler_->record(type_, now() - start_);
+}
+
+} // namespace machine
+} // namespace system
+} // namespace libbitcoin
+
+#endif // HAVE_PROFILE
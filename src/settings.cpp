@@ -422,6 +422,11 @@ chain::checkpoint settings::top_checkpoint() const NOEXCEPT
     return sorted_checkpoints().back();
 }
 
+bool settings::is_under_milestone(size_t height) const NOEXCEPT
+{
+    return milestone.hash() != null_hash && height <= milestone.height();
+}
+
 // Computed properties.
 // ----------------------------------------------------------------------------
 // These are used internal to system.
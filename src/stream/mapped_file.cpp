@@ -0,0 +1,207 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/stream/mapped_file.hpp>
+
+#if defined(HAVE_MSC)
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+#include <algorithm>
+#include <filesystem>
+#include <utility>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/math.hpp>
+#include <bitcoin/system/unicode/utf8_everywhere/paths.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+BC_PUSH_WARNING(NO_REINTERPRET_CAST)
+
+// The whole file is mapped, so the mapping is page (and where the kernel
+// supports file-backed transparent huge pages, hugepage) aligned.
+mapped_file::mapped_file(const std::filesystem::path& path,
+    bool sequential) NOEXCEPT
+  : data_(nullptr), size_(zero)
+{
+#if defined(HAVE_MSC)
+    const auto flags = sequential ? FILE_FLAG_SEQUENTIAL_SCAN :
+        FILE_FLAG_RANDOM_ACCESS;
+    const auto file = CreateFileW(extended_path(path).c_str(), GENERIC_READ,
+        FILE_SHARE_READ, nullptr, OPEN_EXISTING, flags, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return;
+
+    LARGE_INTEGER size{};
+    if (GetFileSizeEx(file, &size) == FALSE || is_zero(size.QuadPart) ||
+        is_limited<size_t>(size.QuadPart))
+    {
+        CloseHandle(file);
+        return;
+    }
+
+    // The view holds a reference to the mapping, which holds the file.
+    const auto map = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0,
+        nullptr);
+    CloseHandle(file);
+    if (map == nullptr)
+        return;
+
+    const auto view = MapViewOfFile(map, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(map);
+    if (view == nullptr)
+        return;
+
+    data_ = static_cast<uint8_t*>(view);
+    size_ = static_cast<size_t>(size.QuadPart);
+#else
+    const auto file = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (file == -1)
+        return;
+
+    struct stat status{};
+    if (::fstat(file, &status) == -1 || status.st_size <= 0 ||
+        is_limited<size_t>(status.st_size))
+    {
+        ::close(file);
+        return;
+    }
+
+    // The mapping holds a reference to the file.
+    const auto size = static_cast<size_t>(status.st_size);
+    const auto map = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+    ::close(file);
+    if (map == MAP_FAILED)
+        return;
+
+    data_ = static_cast<uint8_t*>(map);
+    size_ = size;
+
+    // Advice is a hint, so failure does not invalidate the mapping.
+    ::madvise(map, size, sequential ? MADV_SEQUENTIAL : MADV_RANDOM);
+#if defined(MADV_HUGEPAGE)
+    ::madvise(map, size, MADV_HUGEPAGE);
+#endif
+#endif
+}
+
+mapped_file::mapped_file(mapped_file&& other) NOEXCEPT
+  : data_(std::exchange(other.data_, nullptr)),
+    size_(std::exchange(other.size_, zero))
+{
+}
+
+mapped_file& mapped_file::operator=(mapped_file&& other) NOEXCEPT
+{
+    if (&other != this)
+    {
+        unmap();
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, zero);
+    }
+
+    return *this;
+}
+
+mapped_file::~mapped_file() NOEXCEPT
+{
+    unmap();
+}
+
+bool mapped_file::prefetch(size_t offset, size_t size) const NOEXCEPT
+{
+    return advise(offset, size, true);
+}
+
+bool mapped_file::evict(size_t offset, size_t size) const NOEXCEPT
+{
+    return advise(offset, size, false);
+}
+
+data_reference mapped_file::data() const NOEXCEPT
+{
+    return { data_, std::next(data_, size_) };
+}
+
+size_t mapped_file::size() const NOEXCEPT
+{
+    return size_;
+}
+
+mapped_file::operator bool() const NOEXCEPT
+{
+    return data_ != nullptr;
+}
+
+bool mapped_file::operator!() const NOEXCEPT
+{
+    return data_ == nullptr;
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+bool mapped_file::advise(size_t offset, size_t size, bool needed) const NOEXCEPT
+{
+    if (data_ == nullptr || offset >= size_)
+        return false;
+
+    const auto end = offset + std::min(size, size_ - offset);
+
+#if defined(HAVE_MSC)
+    if (!needed)
+        return true;
+
+    WIN32_MEMORY_RANGE_ENTRY range{ std::next(data_, offset), end - offset };
+    return PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0) != FALSE;
+#else
+    // Advice ranges must begin on a page boundary.
+    const auto page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    const auto start = offset - (offset % page);
+    return ::madvise(std::next(data_, start), end - start,
+        needed ? MADV_WILLNEED : MADV_DONTNEED) != -1;
+#endif
+}
+
+void mapped_file::unmap() NOEXCEPT
+{
+    if (data_ == nullptr)
+        return;
+
+#if defined(HAVE_MSC)
+    UnmapViewOfFile(data_);
+#else
+    ::munmap(data_, size_);
+#endif
+
+    data_ = nullptr;
+    size_ = zero;
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+} // namespace system
+} // namespace libbitcoin
@@ -22,6 +22,9 @@
 #include <bitcoin/system/wallet/neutrino.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <vector>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/filter/filter.hpp>
@@ -41,7 +44,14 @@ bool compute_filter(data_chunk& out, const chain::block& block) NOEXCEPT
 {
     const auto hash = block.hash();
     const auto key = to_siphash_key(slice<zero, to_half(hash_size)>(hash));
-    data_stack scripts{};
+    std::vector<const chain::script*> scripts{};
+    size_t size{};
+
+    const auto push = [&](const chain::script& script) NOEXCEPT
+    {
+        scripts.push_back(&script);
+        size += script.serialized_size(false);
+    };
 
     for (const auto& tx: *block.transactions_ptr())
     {
@@ -54,7 +64,7 @@ bool compute_filter(data_chunk& out, const chain::block& block) NOEXCEPT
 
                 const auto& script = input->prevout->script();
                 if (!script.ops().empty())
-                    scripts.push_back(script.to_data(false));
+                    push(script);
             }
         }
 
@@ -65,20 +75,59 @@ bool compute_filter(data_chunk& out, const chain::block& block) NOEXCEPT
             const auto& script = output->script();
             if (!script.ops().empty() &&
                 !chain::script::is_pay_op_return_pattern(script.ops()))
-                scripts.push_back(script.to_data(false));
+                push(script);
         }
     }
 
-    distinct(scripts);
+    // Scripts are serialized once into a single buffer and hashed in place.
+    data_chunk buffer(size);
+    write::bytes::slab sink(buffer);
+    std::vector<data_slice> items{};
+    items.reserve(scripts.size());
+
+    for (const auto script: scripts)
+    {
+        const auto start = sink.get_write_position();
+        script->to_data(sink, false);
+        items.emplace_back(std::next(buffer.begin(), start),
+            std::next(buffer.begin(), sink.get_write_position()));
+    }
+
+    // Duplicates are removed by the set, so its size is the item count.
+    const auto set = golomb::distinct_set(items, key, rate);
 
     // A vector (push) stream is used because the size is not known a-priori.
-    stream::out::data stream(out);
-    write::bits::ostream writer(stream);
+    write::bytes::data sizer(out);
+    sizer.write_variable(set.size());
+    sizer.flush();
 
-    writer.write_variable(scripts.size());
-    golomb::construct(writer, scripts, golomb_bits, key, rate);
+    // The set is byte aligned following its size, so is appended by word.
+    write::bits::word writer(out);
+    golomb::construct(writer, set, golomb_bits);
     writer.flush();
-    return !!writer;
+    return !!sink && !!sizer;
+}
+
+bool compute_filters(data_stack& out, const chain::blocks& blocks) NOEXCEPT
+{
+    std::atomic_bool success{ true };
+    out.resize(blocks.size());
+
+    // Blocks are independent, so filters are built concurrently (in order).
+    std::transform(poolstl::execution::par, blocks.begin(), blocks.end(),
+        out.begin(), [&](const chain::block& block) NOEXCEPT
+        {
+            data_chunk filter{};
+            if (!compute_filter(filter, block))
+            {
+                success.store(false, std::memory_order_relaxed);
+                filter.clear();
+            }
+
+            return filter;
+        });
+
+    return success.load(std::memory_order_relaxed);
 }
 
 hash_digest compute_header(const hash_digest& previous_header,
@@ -100,13 +149,16 @@ bool match_filter(const block_filter& filter,
     if (script.ops().empty())
         return false;
 
-    stream::in::fast stream(filter.filter);
-    read::bits::fast reader(stream);
-    const auto set_size = reader.read_variable();
+    read::bytes::slice source(filter.filter);
+    const auto set_size = source.read_variable();
 
-    if (!reader)
+    if (!source)
         return false;
 
+    // The set is byte aligned following its size, so is read by word.
+    read::bits::word reader(data_slice(std::next(filter.filter.begin(),
+        source.get_read_position()), filter.filter.end()));
+
     const auto target = script.to_data(false);
     const auto hash = slice<zero, to_half(hash_size)>(filter.hash);
     const auto key = to_siphash_key(hash);
@@ -114,12 +166,37 @@ bool match_filter(const block_filter& filter,
     return golomb::match_single(reader, target, set_size, key, golomb_bits, rate);
 }
 
-bool match_filter(const block_filter& filter,
-    const chain::scripts& scripts) NOEXCEPT
+hashes compute_headers(const hash_digest& previous_header,
+    const data_stack& filters) NOEXCEPT
 {
-    if (scripts.empty())
-        return false;
+    hashes filter_hashes{};
+    return compute_headers(filter_hashes, previous_header, filters);
+}
 
+hashes compute_headers(hashes& filter_hashes,
+    const hash_digest& previous_header, const data_stack& filters) NOEXCEPT
+{
+    // Filter hashes are independent, so are computed concurrently (in order).
+    filter_hashes.resize(filters.size());
+    std::transform(poolstl::execution::par, filters.begin(), filters.end(),
+        filter_hashes.begin(), [](const data_chunk& filter) NOEXCEPT
+        {
+            return bitcoin_hash(filter);
+        });
+
+    // Each header commits to its predecessor, so headers are folded in order.
+    hashes headers{};
+    headers.reserve(filter_hashes.size());
+    auto previous = previous_header;
+    for (const auto& filter_hash: filter_hashes)
+        headers.push_back((previous = bitcoin_hash(filter_hash, previous)));
+
+    return headers;
+}
+
+// local
+static data_stack to_targets(const chain::scripts& scripts) NOEXCEPT
+{
     data_stack stack{};
     stack.reserve(scripts.size());
     std::for_each(scripts.begin(), scripts.end(),
@@ -129,21 +206,39 @@ bool match_filter(const block_filter& filter,
                 stack.push_back(script.to_data(false));
         });
 
-    if (stack.empty())
-        return false;
+    stack.shrink_to_fit();
+    return stack;
+}
 
-    stream::in::fast stream(filter.filter);
-    read::bits::fast reader(stream);
-    const auto set_size = reader.read_variable();
+// local
+static bool match_targets(const block_filter& filter,
+    const data_stack& targets) NOEXCEPT
+{
+    read::bytes::slice source(filter.filter);
+    const auto set_size = source.read_variable();
 
-    if (!reader)
+    if (!source)
         return false;
 
+    // The set is byte aligned following its size, so is read by word.
+    read::bits::word reader(data_slice(std::next(filter.filter.begin(),
+        source.get_read_position()), filter.filter.end()));
+
     const auto hash = slice<zero, to_half(hash_size)>(filter.hash);
     const auto key = to_siphash_key(hash);
 
-    stack.shrink_to_fit();
-    return golomb::match_stack(reader, stack, set_size, key, golomb_bits, rate);
+    return golomb::match_stack(reader, targets, set_size, key, golomb_bits,
+        rate);
+}
+
+bool match_filter(const block_filter& filter,
+    const chain::scripts& scripts) NOEXCEPT
+{
+    if (scripts.empty())
+        return false;
+
+    const auto targets = to_targets(scripts);
+    return !targets.empty() && match_targets(filter, targets);
 }
 
 bool match_filter(const block_filter& filter,
@@ -169,6 +264,43 @@ bool match_filter(const block_filter& filter,
     return match_filter(filter, stack);
 }
 
+heights rescan(const block_filters& filters, size_t first_height,
+    const chain::scripts& scripts) NOEXCEPT
+{
+    // Targets are serialized once, then hashed under each block's key.
+    const auto targets = to_targets(scripts);
+    if (targets.empty() || filters.empty())
+        return {};
+
+    // Filters are independent, so are matched concurrently (order retained).
+    std::vector<uint8_t> matches(filters.size());
+    std::transform(poolstl::execution::par, filters.begin(), filters.end(),
+        matches.begin(), [&](const block_filter& filter) NOEXCEPT
+        {
+            return to_int<uint8_t>(match_targets(filter, targets));
+        });
+
+    heights out{};
+    for (size_t index = 0; index < matches.size(); ++index)
+        if (to_bool(matches[index]))
+            out.push_back(first_height + index);
+
+    return out;
+}
+
+heights rescan(const block_filters& filters, size_t first_height,
+    const wallet::payment_address::list& addresses) NOEXCEPT
+{
+    chain::scripts scripts(addresses.size());
+    std::transform(addresses.begin(), addresses.end(), scripts.begin(),
+        [](const wallet::payment_address& address) NOEXCEPT
+        {
+            return address.output_script();
+        });
+
+    return rescan(filters, first_height, scripts);
+}
+
 } // namespace neutrino
 } // namespace system
 } // namespace libbitcoin
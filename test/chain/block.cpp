@@ -146,6 +146,12 @@ public:
     {
         return block::is_unspent_coinbase_collision();
     }
+
+    void verify_commitments(taproot::commitments& out_batch,
+        std_vector<const input*>& out_owners) const NOEXCEPT
+    {
+        block::verify_commitments(out_batch, out_owners);
+    }
 };
 
 // constructors
@@ -349,6 +355,26 @@ BOOST_AUTO_TEST_CASE(block__constructor__reader__success)
     BOOST_REQUIRE(!block.is_invalid_merkle_root());
 }
 
+BOOST_AUTO_TEST_CASE(block__constructor__slice__success)
+{
+    const auto block1 = get_block();
+    const auto data = block1.to_data(true);
+    test::reporting_arena<false> arena{};
+    read::bytes::slice source(data, &arena);
+    const accessor block(source, true);
+    BOOST_REQUIRE(block.is_valid());
+    BOOST_REQUIRE(!block.is_invalid_merkle_root());
+    BOOST_REQUIRE(block == block1);
+}
+
+BOOST_AUTO_TEST_CASE(block__constructor__slice_witness__expected)
+{
+    const block instance(read::bytes::slice{ expected_block::data() }, true);
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE(instance == expected_block::get());
+    BOOST_REQUIRE_EQUAL(instance.to_data(true), expected_block::data());
+}
+
 // operators
 // ----------------------------------------------------------------------------
 
@@ -418,6 +444,21 @@ BOOST_AUTO_TEST_CASE(block__to_data__stream__expected)
     BOOST_REQUIRE(copy == expected_block::get());
 }
 
+BOOST_AUTO_TEST_CASE(block__to_data__data__round_trip)
+{
+    BOOST_REQUIRE_EQUAL(expected_block::get().to_data(true), expected_block::data());
+}
+
+BOOST_AUTO_TEST_CASE(block__to_data__slab_writer__expected)
+{
+    // Write block to caller-supplied buffer via slab writer.
+    data_chunk data(expected_block::get().serialized_size(true));
+    write::bytes::slab out(data);
+    expected_block::get().to_data(out, true);
+    BOOST_REQUIRE(out);
+    BOOST_REQUIRE_EQUAL(data, expected_block::data());
+}
+
 BOOST_AUTO_TEST_CASE(block__to_data__writer__expected)
 {
     // Write block to stream.
@@ -469,6 +510,45 @@ BOOST_AUTO_TEST_CASE(block__hash__default__matches_header_hash)
 // accept
 // connect
 
+BOOST_AUTO_TEST_CASE(block__connect__assume_valid__scripts_bypassed_other_rules_applied)
+{
+    // Coinbase script omits height (bip34) and claims more than subsidy.
+    const transaction coinbase
+    {
+        1,
+        inputs{ { point{}, script{ "0 0" }, 0 } },
+        outputs{ { 100, script{} } },
+        0
+    };
+
+    // Script execution fails (stack false), prevout is immature (height 0).
+    const transaction spend
+    {
+        1,
+        inputs{ { point{ one_hash, 0 }, script{ "0" }, 0 } },
+        outputs{ { 0, script{} } },
+        0
+    };
+
+    const block instance{ header{}, transactions{ coinbase, spend } };
+    const auto& input = *instance.transactions_ptr()->back()->inputs_ptr()->front();
+    input.prevout = to_shared(output{ 0, script{} });
+
+    context unassumed{ flags::bip34_rule };
+    unassumed.height = 42;
+    auto assumed = unassumed;
+    assumed.assume_valid = true;
+
+    // Script execution is bypassed only when assumed valid.
+    BOOST_REQUIRE_EQUAL(instance.connect(unassumed), error::stack_false);
+    BOOST_REQUIRE_EQUAL(instance.connect(assumed), error::block_success);
+
+    // All other block rules are applied when assumed valid.
+    BOOST_REQUIRE_EQUAL(instance.check(assumed), error::coinbase_height_mismatch);
+    BOOST_REQUIRE_EQUAL(instance.accept(assumed, 210'000, 50), error::coinbase_value_limit);
+    BOOST_REQUIRE_EQUAL(instance.confirm(assumed), error::coinbase_maturity);
+}
+
 // validation (protected)
 // ----------------------------------------------------------------------------
 
@@ -714,6 +794,62 @@ BOOST_AUTO_TEST_CASE(block__is_invalid_merkle_root__block100k__false)
 // is_signature_operations_limited
 // is_unspent_coinbase_collision
 
+// verify_commitments
+
+BOOST_AUTO_TEST_CASE(block__verify_commitments__invalid_commitment__owned_invalid)
+{
+    const ec_xonly key{ 0x42 };
+    const script leaf{ "1" };
+    data_chunk control(add1(ec_xonly_size), 0x01);
+    control.front() = 0xc0;
+
+    const transaction coinbase
+    {
+        1,
+        inputs{ { point{}, script{ "0 0" }, 0 } },
+        outputs{ { 0, script{} } },
+        0
+    };
+
+    const transaction spend
+    {
+        1,
+        inputs
+        {
+            {
+                point{ null_hash, 0 },
+                script{},
+                witness{ data_stack{ leaf.to_data(false), control } },
+                0
+            }
+        },
+        outputs{ { 0, script{} } },
+        0
+    };
+
+    const accessor instance{ header{}, transactions{ coinbase, spend } };
+    const auto& txs = *instance.transactions_ptr();
+    const auto& input = *txs.back()->inputs_ptr()->front();
+    const auto program = script::to_pay_witness_pattern(1, to_chunk(key));
+    input.prevout = to_shared(output{ 0, program });
+
+    taproot::commitments batch{};
+    std_vector<const chain::input*> owners{};
+    instance.verify_commitments(batch, owners);
+    BOOST_REQUIRE_EQUAL(batch.size(), one);
+    BOOST_REQUIRE_EQUAL(owners.size(), one);
+    BOOST_REQUIRE_EQUAL(owners.front(), &input);
+    BOOST_REQUIRE(!batch.front().valid);
+
+    // The witness is unchanged, so its commitment is verified on extraction.
+    hash_cptr out_leaf{};
+    script::cptr out_script{};
+    chunk_cptrs_ptr out_stack{};
+    const auto& witness = input.witness();
+    BOOST_REQUIRE_EQUAL(witness.extract_taproot(out_leaf, out_script,
+        out_stack, program), error::invalid_commitment);
+}
+
 // json
 // ----------------------------------------------------------------------------
 
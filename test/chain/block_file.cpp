@@ -0,0 +1,140 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(block_file_tests)
+
+constexpr uint32_t mainnet_magic = 0xd9b4bef9;
+const auto genesis = base16_chunk(
+    "0100000000000000000000000000000000000000000000000000000000000000"
+    "000000003ba3edfd7a7b12b27ac72c3e67768f617fc81bc3888a51323a9fb8aa"
+    "4b1e5e4a29ab5f49ffff001d1dac2b7c01010000000100000000000000000000"
+    "00000000000000000000000000000000000000000000ffffffff4d04ffff001d"
+    "0104455468652054696d65732030332f4a616e2f32303039204368616e63656c"
+    "6c6f72206f6e206272696e6b206f66207365636f6e64206261696c6f75742066"
+    "6f722062616e6b73ffffffff0100f2052a01000000434104678afdb0fe554827"
+    "1967f1a67130b7105cd6a828e03909a67962e0ea1f61deb649f6bc3f4cef38c4"
+    "f35504e51ec112de5c384df7ba0b8d578a4c702b6bf11d5fac00000000");
+
+static data_chunk frame(const data_chunk& block,
+    uint32_t magic=mainnet_magic) NOEXCEPT
+{
+    const auto size = possible_narrow_cast<uint32_t>(block.size());
+    return build_chunk({ to_little_endian(magic), to_little_endian(size), block });
+}
+
+// scan
+
+BOOST_AUTO_TEST_CASE(block_file__scan__empty__empty)
+{
+    BOOST_REQUIRE(chain::block_file::scan({}, mainnet_magic).empty());
+}
+
+BOOST_AUTO_TEST_CASE(block_file__scan__three_frames_padded__expected)
+{
+    const auto file = build_chunk({ frame(genesis), frame(genesis),
+        frame(genesis), data_chunk(42, 0x00) });
+
+    const auto frames = chain::block_file::scan(file, mainnet_magic);
+    BOOST_REQUIRE_EQUAL(frames.size(), 3u);
+    BOOST_REQUIRE_EQUAL(frames[0].offset, 8u);
+    BOOST_REQUIRE_EQUAL(frames[0].size, genesis.size());
+    BOOST_REQUIRE_EQUAL(frames[1].offset, 8u + genesis.size() + 8u);
+    BOOST_REQUIRE_EQUAL(frames[2].size, genesis.size());
+}
+
+BOOST_AUTO_TEST_CASE(block_file__scan__truncated_last_frame__excluded)
+{
+    auto file = build_chunk({ frame(genesis), frame(genesis) });
+    file.pop_back();
+
+    BOOST_REQUIRE_EQUAL(chain::block_file::scan(file, mainnet_magic).size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(block_file__scan__other_magic__empty)
+{
+    const auto file = frame(genesis, 0x0709110b);
+    BOOST_REQUIRE(chain::block_file::scan(file, mainnet_magic).empty());
+}
+
+// import
+
+BOOST_AUTO_TEST_CASE(block_file__import__blocks__emitted_in_order)
+{
+    data_chunk file{};
+    constexpr auto count = 7u;
+    for (auto index = 0u; index < count; ++index)
+        file = splice(file, frame(genesis));
+
+    const auto expected = chain::block(genesis, true).hash();
+    chain::block_file importer(3, 2);
+    size_t emitted{};
+
+    BOOST_REQUIRE(importer.import(file, mainnet_magic,
+        [&](const code& ec, const chain::block::cptr& block) NOEXCEPT
+        {
+            ++emitted;
+            return !ec && block && block->hash() == expected;
+        }));
+
+    BOOST_REQUIRE_EQUAL(emitted, count);
+    BOOST_REQUIRE_EQUAL(importer.blocks(), count);
+    BOOST_REQUIRE_EQUAL(importer.bytes(), count * genesis.size());
+    BOOST_REQUIRE_EQUAL(importer.depth(), 0u);
+    BOOST_REQUIRE(importer.peak_depth() <= 2u);
+    BOOST_REQUIRE(!is_zero(importer.peak_depth()));
+}
+
+BOOST_AUTO_TEST_CASE(block_file__import__handler_false__stopped)
+{
+    const auto file = build_chunk({ frame(genesis), frame(genesis), frame(genesis) });
+    chain::block_file importer(2, 1);
+    size_t emitted{};
+
+    BOOST_REQUIRE(!importer.import(file, mainnet_magic,
+        [&](const code&, const chain::block::cptr&) NOEXCEPT
+        {
+            return is_zero(emitted++);
+        }));
+
+    BOOST_REQUIRE_EQUAL(emitted, 2u);
+    BOOST_REQUIRE_EQUAL(importer.blocks(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(block_file__import__malformed_block__invalid_frame)
+{
+    auto bad = genesis;
+    bad.resize(100);
+    const auto file = build_chunk({ frame(bad), frame(genesis) });
+    chain::block_file importer(0, 4);
+    std::vector<code> codes{};
+
+    BOOST_REQUIRE(importer.import(file, mainnet_magic,
+        [&](const code& ec, const chain::block::cptr& block) NOEXCEPT
+        {
+            codes.push_back(ec);
+            return !ec == !!block;
+        }));
+
+    BOOST_REQUIRE_EQUAL(codes.size(), 2u);
+    BOOST_REQUIRE_EQUAL(codes[0], error::invalid_frame);
+    BOOST_REQUIRE_EQUAL(codes[1], error::block_success);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
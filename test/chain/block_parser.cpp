@@ -0,0 +1,144 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(block_parser_tests)
+
+using namespace system::chain;
+
+const auto genesis_header = base16_chunk(
+    "0100000000000000000000000000000000000000000000000000000000000000"
+    "000000003ba3edfd7a7b12b27ac72c3e67768f617fc81bc3888a51323a9fb8aa"
+    "4b1e5e4a29ab5f49ffff001d1dac2b7c");
+const auto legacy_tx = base16_chunk(
+    "01000000010000000000000000000000000000000000000000000000000000000000000000ffffffff"
+    "4d04ffff001d0104455468652054696d65732030332f4a616e2f32303039204368616e63656c6c6f"
+    "72206f6e206272696e6b206f66207365636f6e64206261696c6f757420666f722062616e6b73ffffffff"
+    "0100f2052a01000000434104678afdb0fe5548271967f1a67130b7105cd6a828e03909a67962e0ea1f"
+    "61deb649f6bc3f4cef38c4f35504e51ec112de5c384df7ba0b8d578a4c702b6bf11d5fac00000000");
+const auto segwit_tx = base16_chunk(
+    "0200000000010140d43a99926d43eb0e619bf0b3d83b4a31f60c176beecfb9d35bf45e54d0f742"
+    "0100000017160014a4b4ca48de0b3fffc15404a1acdc8dbaae226955ffffffff0100e1f50500000000"
+    "17a9144a1154d50b03292b3024370901711946cb7cccc387024830450221008604ef8f6d8afa892dee"
+    "0f31259b6ce02dd70c545cfcfed8148179971876c54a022076d771d6e91bed212783c9b06e0de600fa"
+    "b2d518fad6f15a2b191d7fbd262a3e0121039d25ab79f41f75ceaf882411fd41fa670a4c672c23ff"
+    "af0e361a969cde0692e800000000");
+const auto block_data = build_chunk({ genesis_header, data_chunk{ 0x02 },
+    legacy_tx, segwit_tx });
+
+static block_parser::result push_chunks(block_parser& parser,
+    const data_chunk& data, size_t chunk) NOEXCEPT
+{
+    auto result = block_parser::result::incomplete;
+    for (size_t offset = 0; offset < data.size(); offset += chunk)
+    {
+        const auto size = std::min(chunk, data.size() - offset);
+        result = parser.push({ &data[offset], std::next(&data[offset], size) });
+    }
+
+    return result;
+}
+
+BOOST_AUTO_TEST_CASE(block_parser__push__whole__expected)
+{
+    const block expected(block_data, true);
+    BOOST_REQUIRE(expected.is_valid());
+
+    block_parser parser{};
+    BOOST_REQUIRE(parser.push(block_data) == block_parser::result::complete);
+    BOOST_REQUIRE(parser.state() == block_parser::result::complete);
+    BOOST_REQUIRE(parser.block_ptr());
+    BOOST_REQUIRE(*parser.block_ptr() == expected);
+    BOOST_REQUIRE_EQUAL(parser.block_ptr()->hash(), expected.hash());
+    BOOST_REQUIRE_EQUAL(parser.transactions().size(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(block_parser__push__fragmented__expected)
+{
+    const block expected(block_data, true);
+    wire_scanner::bounds_list scanned{};
+    BOOST_REQUIRE(wire_scanner::scan_block(scanned, block_data));
+
+    for (const auto chunk: { 1u, 2u, 3u, 7u, 64u, 81u, 200u })
+    {
+        block_parser parser{};
+        BOOST_REQUIRE(push_chunks(parser, block_data, chunk) ==
+            block_parser::result::complete);
+        BOOST_REQUIRE(*parser.block_ptr() == expected);
+
+        const auto& bounds = parser.bounds();
+        BOOST_REQUIRE_EQUAL(bounds.size(), scanned.size());
+        for (size_t index = 0; index < bounds.size(); ++index)
+        {
+            BOOST_REQUIRE_EQUAL(bounds[index].offset, scanned[index].offset);
+            BOOST_REQUIRE_EQUAL(bounds[index].nominal, scanned[index].nominal);
+            BOOST_REQUIRE_EQUAL(bounds[index].witnessed, scanned[index].witnessed);
+            BOOST_REQUIRE_EQUAL(bounds[index].segregated, scanned[index].segregated);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(block_parser__push__hashes__expected)
+{
+    block_parser parser{};
+    BOOST_REQUIRE(push_chunks(parser, block_data, 5u) ==
+        block_parser::result::complete);
+
+    const auto& txs = parser.transactions();
+    BOOST_REQUIRE_EQUAL(parser.header_ptr()->hash(), header(genesis_header).hash());
+    BOOST_REQUIRE_EQUAL(txs[0]->hash(false), transaction(legacy_tx, true).hash(false));
+    BOOST_REQUIRE_EQUAL(txs[1]->hash(false), transaction(segwit_tx, true).hash(false));
+    BOOST_REQUIRE_EQUAL(txs[1]->hash(true), transaction(segwit_tx, true).hash(true));
+}
+
+BOOST_AUTO_TEST_CASE(block_parser__push__truncated__incomplete)
+{
+    const data_chunk truncated(block_data.begin(), std::prev(block_data.end()));
+
+    block_parser parser{};
+    BOOST_REQUIRE(push_chunks(parser, truncated, 10u) ==
+        block_parser::result::incomplete);
+    BOOST_REQUIRE(parser.header_ptr());
+    BOOST_REQUIRE_EQUAL(parser.transactions().size(), 1u);
+    BOOST_REQUIRE(!parser.block_ptr());
+}
+
+BOOST_AUTO_TEST_CASE(block_parser__push__trailing_bytes__invalid)
+{
+    const auto data = build_chunk({ block_data, data_chunk{ 0x00 } });
+
+    block_parser parser{};
+    BOOST_REQUIRE(parser.push(data) == block_parser::result::invalid);
+    BOOST_REQUIRE(parser.push(block_data) == block_parser::result::invalid);
+}
+
+BOOST_AUTO_TEST_CASE(block_parser__reset__complete__reparses)
+{
+    block_parser parser{};
+    BOOST_REQUIRE(parser.push(block_data) == block_parser::result::complete);
+
+    parser.reset();
+    BOOST_REQUIRE(parser.state() == block_parser::result::incomplete);
+    BOOST_REQUIRE(!parser.header_ptr());
+    BOOST_REQUIRE(parser.transactions().empty());
+    BOOST_REQUIRE(push_chunks(parser, block_data, 11u) ==
+        block_parser::result::complete);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -24,6 +24,7 @@ struct test_chain_state
   : chain::chain_state
 {
     using chain::chain_state::work_required;
+    using chain::chain_state::median_time_past;
 };
 
 chain::chain_state::data get_values(size_t retargeting_interval)
@@ -57,4 +58,65 @@ BOOST_AUTO_TEST_CASE(chain_state__work_required_retarget__overflow_patch_enabled
     BOOST_REQUIRE_EQUAL(work, settings.proof_of_work_limit);
 }
 
+BOOST_AUTO_TEST_CASE(chain_state__median_time_past__unordered_window__modulo_two_median)
+{
+    const settings settings(chain::selection::mainnet);
+    chain::chain_state::data values{};
+    for (const auto time: { 9u, 3u, 7u, 1u, 11u, 5u, 2u, 10u, 4u, 8u, 6u })
+        values.timestamp.ordered.push_back(time);
+
+    BOOST_REQUIRE_EQUAL(test_chain_state::median_time_past(values, settings.forks), 6u);
+    values.timestamp.ordered.pop_front();
+    BOOST_REQUIRE_EQUAL(test_chain_state::median_time_past(values, settings.forks), 6u);
+    values.timestamp.ordered.clear();
+    BOOST_REQUIRE_EQUAL(test_chain_state::median_time_past(values, settings.forks), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(chain_state__roll__genesis_children__same_as_parent_construction)
+{
+    const settings settings(chain::selection::mainnet);
+    const auto& genesis = settings.genesis_block.header();
+
+    chain::chain_state::data values{};
+    values.hash = genesis.hash();
+    values.bits.self = genesis.bits();
+    values.version.self = genesis.version();
+    values.timestamp.self = genesis.timestamp();
+    values.cumulative_work = genesis.proof();
+    chain::chain_state::reserve(values, chain::chain_state::get_map(20, settings));
+
+    auto expected = std::make_shared<const chain::chain_state>(
+        chain::chain_state::data{ values }, settings);
+
+    for (uint32_t nonce = 0; nonce < 20u; ++nonce)
+    {
+        const chain::header child
+        {
+            genesis.version(),
+            values.hash,
+            null_hash,
+            genesis.timestamp() + add1(nonce) * 600u,
+            genesis.bits(),
+            nonce
+        };
+
+        expected = std::make_shared<const chain::chain_state>(*expected,
+            child, settings);
+        chain::chain_state::roll(values, child, settings);
+    }
+
+    const chain::chain_state rolled{ std::move(values), settings };
+    BOOST_REQUIRE_EQUAL(rolled.height(), 20u);
+    BOOST_REQUIRE_EQUAL(rolled.height(), expected->height());
+    BOOST_REQUIRE_EQUAL(rolled.hash(), expected->hash());
+    BOOST_REQUIRE_EQUAL(rolled.flags(), expected->flags());
+    BOOST_REQUIRE_EQUAL(rolled.timestamp(), expected->timestamp());
+    BOOST_REQUIRE_EQUAL(rolled.median_time_past(), expected->median_time_past());
+    BOOST_REQUIRE_EQUAL(rolled.work_required(), expected->work_required());
+    BOOST_REQUIRE_EQUAL(rolled.minimum_block_version(), expected->minimum_block_version());
+    BOOST_REQUIRE(rolled.cumulative_work() == expected->cumulative_work());
+    BOOST_REQUIRE(rolled.fixed_cumulative_work() == expected->fixed_cumulative_work());
+    BOOST_REQUIRE(rolled.cumulative_work() == uint256_t{ rolled.fixed_cumulative_work() });
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -248,6 +248,16 @@ static_assert(compact::compress(compact::expand(mainnet)) == mainnet);
 constexpr auto regtest = 0x207fffff;
 static_assert(compact::compress(compact::expand(regtest)) == regtest);
 
+// expand_fixed
+
+static_assert(compact::expand_fixed(mainnet) == uint256{ uint256::limbs_type{ 0, 0, 0, 0x00000000ffff0000 } });
+static_assert(compact::expand_fixed(regtest) == uint256{ uint256::limbs_type{ 0, 0, 0, 0x7fffff0000000000 } });
+static_assert(compact::expand_fixed(0x03123456) == 0x123456u);
+static_assert(compact::expand_fixed(0x02123456) == 0x1234u);
+static_assert(compact::expand_fixed(0x00000000) == 0u);
+static_assert(compact::expand_fixed(factory(-3, true, 0x000000ff)) == 0u);
+static_assert(compact::expand_fixed(factory(252, false, 0x0000ffff)) == 0u);
+
 // compress/expand
 
 static_assert(compact::expand(compact::compress(uint256_t(0))) == uint256_t(0));
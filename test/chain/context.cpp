@@ -20,9 +20,27 @@
 
 BOOST_AUTO_TEST_SUITE(context_tests)
 
-BOOST_AUTO_TEST_CASE(context_test)
+BOOST_AUTO_TEST_CASE(context__is_assumed_valid__default__false)
 {
-    BOOST_REQUIRE(true);
+    const chain::context instance{};
+    BOOST_REQUIRE(!instance.is_assumed_valid());
+}
+
+BOOST_AUTO_TEST_CASE(context__is_assumed_valid__assume_valid__true)
+{
+    chain::context instance{};
+    instance.assume_valid = true;
+    BOOST_REQUIRE(instance.is_assumed_valid());
+}
+
+BOOST_AUTO_TEST_CASE(context__equality__distinct_assume_valid__false)
+{
+    const chain::context instance1{ chain::flags::bip16_rule, 0, 0, 0, 0, 0 };
+    chain::context instance2{ chain::flags::bip16_rule, 0, 0, 0, 0, 0 };
+    BOOST_REQUIRE(instance1 == instance2);
+
+    instance2.assume_valid = true;
+    BOOST_REQUIRE(instance1 != instance2);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
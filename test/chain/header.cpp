@@ -157,6 +157,24 @@ BOOST_AUTO_TEST_CASE(header__constructor__reader__expected)
     BOOST_REQUIRE(instance == expected_header);
 }
 
+BOOST_AUTO_TEST_CASE(header__constructor__slice__expected)
+{
+    const auto data = expected_header.to_data();
+    read::bytes::slice source(data);
+    const header instance(source);
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE(instance == expected_header);
+    BOOST_REQUIRE(source.is_exhausted());
+}
+
+BOOST_AUTO_TEST_CASE(header__constructor__slice_truncated__invalid)
+{
+    auto data = expected_header.to_data();
+    data.pop_back();
+    const header instance(read::bytes::slice{ data });
+    BOOST_REQUIRE(!instance.is_valid());
+}
+
 // operators
 // ----------------------------------------------------------------------------
 
@@ -144,6 +144,13 @@ public:
     {
         return interpreter<contiguous_stack>::connect(ctx, *this, index);
     }
+
+    template <uint32_t Rules>
+    code connect_specialized(uint32_t index) const NOEXCEPT
+    {
+        return interpreter<contiguous_stack, Rules>::connect({ Rules }, *this,
+            index);
+    }
 };
 
 transaction_accessor test_tx(const script_test& test)
@@ -173,6 +180,34 @@ transaction_accessor test_tx(const script_test& test)
     return tx;
 }
 
+// As test_tx, but spends a non-null point (a coinbase is never connected).
+transaction_accessor spend_tx(const script_test& test)
+{
+    const script in{ test.input };
+    const script out{ test.output };
+
+    if (!in.is_valid() || !out.is_valid())
+        return {};
+
+    const transaction_accessor tx
+    {
+        test.version,
+        inputs
+        {
+            {
+                point{ one_hash, 0 },
+                in,
+                test.input_sequence
+            }
+        },
+        outputs{},
+        test.locktime
+    };
+
+    tx.inputs_ptr()->front()->prevout = to_shared(output{ 0u, out });
+    return tx;
+}
+
 std::string test_name(const script_test& test)
 {
     std::stringstream out;
@@ -597,6 +632,65 @@ BOOST_AUTO_TEST_CASE(script__context_free__invalid)
     }
 }
 
+BOOST_AUTO_TEST_CASE(script__context_free__invalid_assume_valid__connect_bypassed)
+{
+    context assumed{ all_but_taproot };
+    assumed.assume_valid = true;
+    const context unassumed{ all_but_taproot };
+
+    for (const auto& test: invalid_context_free_scripts)
+    {
+        const auto tx = spend_tx(test);
+        const auto name = test_name(test);
+        BOOST_REQUIRE_MESSAGE(tx.is_valid(), name);
+
+        // Script execution is bypassed only when assumed valid.
+        BOOST_CHECK_MESSAGE(tx.connect(unassumed) != error::transaction_success, name);
+        BOOST_CHECK_MESSAGE(tx.connect(assumed) == error::transaction_success, name);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(script__context_free__valid_assume_valid__success)
+{
+    context assumed{ all_but_taproot };
+    assumed.assume_valid = true;
+    const context unassumed{ all_but_taproot };
+
+    for (const auto& test: valid_context_free_scripts)
+    {
+        const auto tx = spend_tx(test);
+        const auto name = test_name(test);
+        BOOST_REQUIRE_MESSAGE(tx.is_valid(), name);
+        BOOST_CHECK_MESSAGE(tx.connect(unassumed) == error::transaction_success, name);
+        BOOST_CHECK_MESSAGE(tx.connect(assumed) == error::transaction_success, name);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(script__connect__specialized_rules__same_result)
+{
+    const auto same = [](const script_test_list& tests) NOEXCEPT
+    {
+        for (const auto& test: tests)
+        {
+            const auto tx = test_tx(test);
+            const auto name = test_name(test);
+            BOOST_CHECK_MESSAGE(tx.connect_specialized<rules::pre_segwit>(0) == tx.connect({ rules::pre_segwit }, 0), name);
+            BOOST_CHECK_MESSAGE(tx.connect_specialized<rules::segwit>(0) == tx.connect({ rules::segwit }, 0), name);
+            BOOST_CHECK_MESSAGE(tx.connect_specialized<rules::taproot>(0) == tx.connect({ rules::taproot }, 0), name);
+        }
+    };
+
+    same(valid_bip16_scripts);
+    same(invalidated_bip16_scripts);
+    same(valid_bip65_scripts);
+    same(invalid_bip65_scripts);
+    same(invalidated_bip65_scripts);
+    same(valid_multisig_scripts);
+    same(invalid_multisig_scripts);
+    same(valid_context_free_scripts);
+    same(invalid_context_free_scripts);
+}
+
 BOOST_AUTO_TEST_CASE(script__parse__not_invalid)
 {
     for (const auto& test: not_invalid_parse_scripts)
@@ -22,9 +22,91 @@ BOOST_AUTO_TEST_SUITE(taproot_tests)
 
 using namespace system::chain;
 
-BOOST_AUTO_TEST_CASE(taproot_test)
+class accessor
+  : public taproot
 {
-    BOOST_REQUIRE(true);
+public:
+    using taproot::merkle_root;
+    using taproot::tweak_hash;
+};
+
+const auto secret = base16_hash(
+    "ce8f4b713ffdd2658900845251890f30371856be201cd1f5b3d970f793634333");
+
+// Script-path commitment to a checksig leaf at the given path depth.
+static taproot::commitment commit(size_t depth, bool tweaked=true) NOEXCEPT
+{
+    ec_compressed point{};
+    BOOST_REQUIRE(secret_to_public(point, secret));
+    const auto& internal = unsafe_array_cast<uint8_t, ec_xonly_size>(
+        std::next(point.data()));
+
+    const auto leaf_script = to_shared<script>(script{ "[" +
+        encode_base16(internal) + "] checksig" });
+    const auto leaf = taproot::leaf_hash(0xc0, *leaf_script);
+
+    tapscript::keys_t keys{};
+    for (size_t level = 0; level < depth; ++level)
+        keys.at(level) = ec_xonly{ narrow_cast<uint8_t>(add1(level)) };
+
+    const auto root = accessor::merkle_root(keys, depth, leaf);
+    auto output = point;
+    BOOST_REQUIRE(ec_add(output, accessor::tweak_hash(internal, root)));
+    const auto parity = output.front() != ec_even_sign;
+    const auto& out_key = unsafe_array_cast<uint8_t, ec_xonly_size>(
+        std::next(output.data()));
+
+    data_chunk control{ parity ? uint8_t{ 0xc1 } : uint8_t{ 0xc0 } };
+    control.insert(control.end(), internal.begin(), internal.end());
+    for (size_t level = 0; level < depth; ++level)
+        control.insert(control.end(), keys.at(level).begin(),
+            keys.at(level).end());
+
+    return
+    {
+        tapscript{ to_shared(std::move(control)) },
+        tweaked ? out_key : internal,
+        leaf_script,
+        leaf,
+        false
+    };
+}
+
+BOOST_AUTO_TEST_CASE(taproot__verify_commits__empty__empty)
+{
+    taproot::commitments batch{};
+    taproot::verify_commits(batch);
+    BOOST_REQUIRE(batch.empty());
+}
+
+BOOST_AUTO_TEST_CASE(taproot__verify_commits__mixed_depths__expected)
+{
+    taproot::commitments batch{};
+    for (size_t depth = 0; depth < 20; ++depth)
+        batch.push_back(commit(depth % 5u));
+
+    taproot::verify_commits(batch);
+    for (const auto& item: batch)
+    {
+        BOOST_REQUIRE(item.control.is_valid());
+        BOOST_REQUIRE(item.valid);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(taproot__verify_commits__untweaked_keys__same_as_verify_commit)
+{
+    taproot::commitments batch{};
+    for (size_t depth = 0; depth < 20; ++depth)
+        batch.push_back(commit(depth % 3u, is_even(depth)));
+
+    taproot::verify_commits(batch);
+    for (size_t depth = 0; depth < batch.size(); ++depth)
+    {
+        const auto& item = batch.at(depth);
+        BOOST_REQUIRE_EQUAL(item.valid, is_even(depth));
+        BOOST_REQUIRE_EQUAL(item.valid, taproot::verify_commit(item.control,
+            item.out_key, item.leaf));
+    }
 }
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -17,6 +17,7 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include "../test.hpp"
+#include <thread>
 
 BOOST_AUTO_TEST_SUITE(transaction_tests)
 
@@ -87,6 +88,14 @@ static const auto tx4_data = base16_chunk(
 static const auto tx4_hash = base16_hash(
     "cb1e303db604f066225eb14d59d3f8d2231200817bc9d4610d2802586bd93f8a");
 
+static const auto tx5_data = base16_chunk(
+    "0200000000010140d43a99926d43eb0e619bf0b3d83b4a31f60c176beecfb9d35bf45e54d0f742"
+    "0100000017160014a4b4ca48de0b3fffc15404a1acdc8dbaae226955ffffffff0100e1f50500000000"
+    "17a9144a1154d50b03292b3024370901711946cb7cccc387024830450221008604ef8f6d8afa892dee"
+    "0f31259b6ce02dd70c545cfcfed8148179971876c54a022076d771d6e91bed212783c9b06e0de600fa"
+    "b2d518fad6f15a2b191d7fbd262a3e0121039d25ab79f41f75ceaf882411fd41fa670a4c672c23ff"
+    "af0e361a969cde0692e800000000");
+
 // Access protected validation methods.
 class accessor
   : public transaction
@@ -315,6 +324,45 @@ BOOST_AUTO_TEST_CASE(transaction__constructor__reader_2__success)
     BOOST_REQUIRE_EQUAL(tx.serialized_size(true), tx2_data.size());
 }
 
+BOOST_AUTO_TEST_CASE(transaction__constructor__slice_1__success)
+{
+    read::bytes::slice source(tx1_data);
+    const transaction tx(source, true);
+    BOOST_REQUIRE(tx.is_valid());
+    BOOST_REQUIRE(source.is_exhausted());
+    BOOST_REQUIRE_EQUAL(tx.hash(false), tx1_hash);
+    BOOST_REQUIRE_EQUAL(tx.to_data(true), tx1_data);
+    BOOST_REQUIRE_EQUAL(tx.serialized_size(true), tx1_data.size());
+}
+
+BOOST_AUTO_TEST_CASE(transaction__constructor__slice_2__equals_reader)
+{
+    read::bytes::copy source(tx2_data);
+    const transaction expected(source, true);
+    const transaction tx(read::bytes::slice{ tx2_data }, true);
+    BOOST_REQUIRE(tx.is_valid());
+    BOOST_REQUIRE(tx == expected);
+    BOOST_REQUIRE_EQUAL(tx.hash(false), tx2_hash);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__constructor__slice_truncated__invalid)
+{
+    const data_slice truncated(tx1_data.begin(), std::prev(tx1_data.end()));
+    const transaction tx(read::bytes::slice{ truncated }, true);
+    BOOST_REQUIRE(!tx.is_valid());
+}
+
+BOOST_AUTO_TEST_CASE(transaction__constructor__data_segregated__equals_stream)
+{
+    stream::in::fast stream(tx5_data);
+    const transaction expected(stream, true);
+    const transaction tx(tx5_data, true);
+    BOOST_REQUIRE(tx.is_valid());
+    BOOST_REQUIRE(tx == expected);
+    BOOST_REQUIRE_EQUAL(tx.hash(true), expected.hash(true));
+    BOOST_REQUIRE_EQUAL(tx.to_data(true), tx5_data);
+}
+
 // operators
 // ----------------------------------------------------------------------------
 
@@ -406,6 +454,82 @@ BOOST_AUTO_TEST_CASE(transaction__to_data__writer__expected)
     BOOST_REQUIRE(copy == tx);
 }
 
+BOOST_AUTO_TEST_CASE(transaction__to_data__slab_writer__expected)
+{
+    const transaction tx(tx1_data, true);
+    BOOST_REQUIRE(tx.is_valid());
+
+    // Write transaction to caller-supplied buffer via slab writer.
+    data_chunk data(tx.serialized_size(true));
+    write::bytes::slab out(data);
+    tx.to_data(out, true);
+    BOOST_REQUIRE(out);
+    BOOST_REQUIRE_EQUAL(out.get_write_position(), data.size());
+    BOOST_REQUIRE_EQUAL(data, tx1_data);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__to_data__slab_writer_undersized__invalid)
+{
+    const transaction tx(tx1_data, true);
+    BOOST_REQUIRE(tx.is_valid());
+
+    data_chunk data(sub1(tx.serialized_size(true)));
+    write::bytes::slab out(data);
+    tx.to_data(out, true);
+    BOOST_REQUIRE(!out);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__to_data__tee_writer_segregated__expected_hashes)
+{
+    const transaction tx(tx5_data, true);
+    BOOST_REQUIRE(tx.is_segregated());
+
+    data_chunk data(tx.serialized_size(true));
+    write::bytes::tee out(data, true);
+    tx.to_data(out, true);
+    BOOST_REQUIRE(out);
+    BOOST_REQUIRE_EQUAL(data, tx5_data);
+    BOOST_REQUIRE_EQUAL(out.nominal_hash(), bitcoin_hash(tx.to_data(false)));
+    BOOST_REQUIRE_EQUAL(out.witness_hash(), bitcoin_hash(tx5_data));
+}
+
+BOOST_AUTO_TEST_CASE(transaction__to_hashed_data__legacy__expected_and_cached)
+{
+    const transaction tx(tx1_data, true);
+    BOOST_REQUIRE_EQUAL(tx.to_hashed_data(true), tx1_data);
+    BOOST_REQUIRE_EQUAL(tx.get_hash(false), tx1_hash);
+    BOOST_REQUIRE_EQUAL(tx.hash(true), tx1_hash);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__to_hashed_data__segregated__expected_and_cached)
+{
+    const transaction expected(tx5_data, true);
+    const transaction tx(tx5_data, true);
+    BOOST_REQUIRE_EQUAL(tx.to_hashed_data(true), tx5_data);
+    BOOST_REQUIRE_EQUAL(tx.get_hash(false), expected.hash(false));
+    BOOST_REQUIRE_EQUAL(tx.get_hash(true), expected.hash(true));
+    BOOST_REQUIRE_NE(tx.get_hash(false), tx.get_hash(true));
+}
+
+BOOST_AUTO_TEST_CASE(transaction__to_hashed_data__segregated_nominal__expected_nominal_cached)
+{
+    const transaction expected(tx5_data, true);
+    const transaction tx(tx5_data, true);
+    BOOST_REQUIRE_EQUAL(tx.to_hashed_data(false), expected.to_data(false));
+    BOOST_REQUIRE_EQUAL(tx.get_hash(false), expected.hash(false));
+    BOOST_REQUIRE_EQUAL(tx.get_hash(true), expected.hash(true));
+}
+
+BOOST_AUTO_TEST_CASE(transaction__to_hashed_data__hashes_set__not_replaced)
+{
+    const transaction tx(tx5_data, true);
+    tx.set_nominal_hash(one_hash);
+    tx.set_witness_hash(one_hash);
+    BOOST_REQUIRE_EQUAL(tx.to_hashed_data(true), tx5_data);
+    BOOST_REQUIRE_EQUAL(tx.get_hash(false), one_hash);
+    BOOST_REQUIRE_EQUAL(tx.get_hash(true), one_hash);
+}
+
 // properties
 // ----------------------------------------------------------------------------
 
@@ -580,6 +704,34 @@ BOOST_AUTO_TEST_CASE(transaction__set_hash__get_hash__expected)
     BOOST_REQUIRE_EQUAL(instance.get_hash(true), tx4_hash);
 }
 
+BOOST_AUTO_TEST_CASE(transaction__get_hash__concurrent__expected)
+{
+    const transaction instance(tx4_data, true);
+    std_vector<std::thread> workers{};
+    std::array<const hash_digest*, 4> nominal{};
+    std::array<const hash_digest*, 4> witness{};
+
+    for (size_t thread = 0; thread < nominal.size(); ++thread)
+    {
+        workers.emplace_back([&, thread]() NOEXCEPT
+        {
+            nominal.at(thread) = &instance.get_hash(false);
+            witness.at(thread) = &instance.get_hash(true);
+        });
+    }
+
+    for (auto& worker: workers)
+        worker.join();
+
+    for (size_t thread = 0; thread < nominal.size(); ++thread)
+    {
+        BOOST_REQUIRE_EQUAL(nominal.at(thread), &instance.get_hash(false));
+        BOOST_REQUIRE_EQUAL(witness.at(thread), &instance.get_hash(true));
+    }
+
+    BOOST_REQUIRE_EQUAL(instance.get_hash(false), tx4_hash);
+}
+
 BOOST_AUTO_TEST_CASE(transaction__is_coinbase__empty__false)
 {
     transaction instance;
@@ -0,0 +1,114 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(wire_scanner_tests)
+
+using namespace system::chain;
+
+const auto genesis_header = base16_chunk(
+    "0100000000000000000000000000000000000000000000000000000000000000"
+    "000000003ba3edfd7a7b12b27ac72c3e67768f617fc81bc3888a51323a9fb8aa"
+    "4b1e5e4a29ab5f49ffff001d1dac2b7c");
+const auto legacy_tx = base16_chunk(
+    "01000000010000000000000000000000000000000000000000000000000000000000000000ffffffff"
+    "4d04ffff001d0104455468652054696d65732030332f4a616e2f32303039204368616e63656c6c6f"
+    "72206f6e206272696e6b206f66207365636f6e64206261696c6f757420666f722062616e6b73ffffffff"
+    "0100f2052a01000000434104678afdb0fe5548271967f1a67130b7105cd6a828e03909a67962e0ea1f"
+    "61deb649f6bc3f4cef38c4f35504e51ec112de5c384df7ba0b8d578a4c702b6bf11d5fac00000000");
+const auto segwit_tx = base16_chunk(
+    "0200000000010140d43a99926d43eb0e619bf0b3d83b4a31f60c176beecfb9d35bf45e54d0f742"
+    "0100000017160014a4b4ca48de0b3fffc15404a1acdc8dbaae226955ffffffff0100e1f50500000000"
+    "17a9144a1154d50b03292b3024370901711946cb7cccc387024830450221008604ef8f6d8afa892dee"
+    "0f31259b6ce02dd70c545cfcfed8148179971876c54a022076d771d6e91bed212783c9b06e0de600fa"
+    "b2d518fad6f15a2b191d7fbd262a3e0121039d25ab79f41f75ceaf882411fd41fa670a4c672c23ff"
+    "af0e361a969cde0692e800000000");
+
+// scan_transaction
+
+BOOST_AUTO_TEST_CASE(wire_scanner__scan_transaction__legacy__expected)
+{
+    const transaction tx(legacy_tx, true);
+    BOOST_REQUIRE(tx.is_valid());
+
+    wire_scanner::bounds bounds{};
+    BOOST_REQUIRE(wire_scanner::scan_transaction(bounds, legacy_tx));
+    BOOST_REQUIRE(!bounds.segregated);
+    BOOST_REQUIRE_EQUAL(bounds.offset, zero);
+    BOOST_REQUIRE_EQUAL(bounds.nominal, tx.serialized_size(false));
+    BOOST_REQUIRE_EQUAL(bounds.witnessed, legacy_tx.size());
+}
+
+BOOST_AUTO_TEST_CASE(wire_scanner__scan_transaction__segwit__expected)
+{
+    const transaction tx(segwit_tx, true);
+    BOOST_REQUIRE(tx.is_valid());
+    BOOST_REQUIRE(tx.is_segregated());
+
+    wire_scanner::bounds bounds{};
+    BOOST_REQUIRE(wire_scanner::scan_transaction(bounds, segwit_tx));
+    BOOST_REQUIRE(bounds.segregated);
+    BOOST_REQUIRE_EQUAL(bounds.nominal, tx.serialized_size(false));
+    BOOST_REQUIRE_EQUAL(bounds.witnessed, tx.serialized_size(true));
+    BOOST_REQUIRE_EQUAL(bounds.witnessed, segwit_tx.size());
+}
+
+BOOST_AUTO_TEST_CASE(wire_scanner__scan_transaction__truncated__false)
+{
+    const data_chunk truncated(segwit_tx.begin(), std::prev(segwit_tx.end()));
+
+    wire_scanner::bounds bounds{};
+    BOOST_REQUIRE(!wire_scanner::scan_transaction(bounds, truncated));
+}
+
+// scan_block
+
+BOOST_AUTO_TEST_CASE(wire_scanner__scan_block__hashes__expected)
+{
+    const auto data = build_chunk({ genesis_header, data_chunk{ 0x02 },
+        legacy_tx, segwit_tx });
+
+    const block instance(data, true);
+    BOOST_REQUIRE(instance.is_valid());
+
+    wire_scanner::bounds_list bounds{};
+    BOOST_REQUIRE(wire_scanner::scan_block(bounds, data));
+    BOOST_REQUIRE_EQUAL(bounds.size(), 2u);
+    BOOST_REQUIRE_EQUAL(bounds[0].offset, 81u);
+    BOOST_REQUIRE_EQUAL(bounds[1].offset, 81u + legacy_tx.size());
+
+    const auto txids = wire_scanner::nominal_hashes(data, bounds);
+    BOOST_REQUIRE_EQUAL(txids, instance.transaction_hashes(false));
+
+    const auto wtxids = wire_scanner::witness_hashes(data, bounds);
+    BOOST_REQUIRE_EQUAL(wtxids.size(), 2u);
+    BOOST_REQUIRE_EQUAL(wtxids[0], null_hash);
+    BOOST_REQUIRE_EQUAL(wtxids[1], transaction(segwit_tx, true).hash(true));
+}
+
+BOOST_AUTO_TEST_CASE(wire_scanner__scan_block__trailing_bytes__false)
+{
+    const auto data = build_chunk({ genesis_header, data_chunk{ 0x01 },
+        legacy_tx, data_chunk{ 0x00 } });
+
+    wire_scanner::bounds_list bounds{};
+    BOOST_REQUIRE(!wire_scanner::scan_block(bounds, data));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -204,6 +204,103 @@ BOOST_AUTO_TEST_CASE(witness__block__without_witness__checks)
     BOOST_REQUIRE(!instance.check());
 }
 
+// extract_commitment
+// ----------------------------------------------------------------------------
+
+const ec_xonly commitment_key{ 0x42 };
+const script commitment_leaf{ "1" };
+
+static script taproot_program() NOEXCEPT
+{
+    return script::to_pay_witness_pattern(1, to_chunk(commitment_key));
+}
+
+static chain::witness script_path() NOEXCEPT
+{
+    data_chunk control(add1(ec_xonly_size), 0x01);
+    control.front() = 0xc0;
+    return data_stack{ { 0x2a }, commitment_leaf.to_data(false), control };
+}
+
+BOOST_AUTO_TEST_CASE(witness__extract_commitment__not_taproot__false)
+{
+    taproot::commitments batch{};
+    const auto program = script::to_pay_witness_pattern(0,
+        to_chunk(commitment_key));
+    BOOST_REQUIRE(!script_path().extract_commitment(batch, program));
+    BOOST_REQUIRE(batch.empty());
+}
+
+BOOST_AUTO_TEST_CASE(witness__extract_commitment__key_path__false)
+{
+    taproot::commitments batch{};
+    const chain::witness instance{ data_stack{ data_chunk(64, 0x2a) } };
+    BOOST_REQUIRE(!instance.extract_commitment(batch, taproot_program()));
+    BOOST_REQUIRE(batch.empty());
+}
+
+BOOST_AUTO_TEST_CASE(witness__extract_commitment__script_path__expected)
+{
+    taproot::commitments batch{};
+    BOOST_REQUIRE(script_path().extract_commitment(batch, taproot_program()));
+    BOOST_REQUIRE_EQUAL(batch.size(), one);
+
+    const auto& item = batch.front();
+    BOOST_REQUIRE(item.control.is_tapscript());
+    BOOST_REQUIRE_EQUAL(item.out_key, commitment_key);
+    BOOST_REQUIRE(*item.leaf_script == commitment_leaf);
+    BOOST_REQUIRE_EQUAL(item.leaf, taproot::leaf_hash(0xc0, commitment_leaf));
+    BOOST_REQUIRE(!item.valid);
+}
+
+BOOST_AUTO_TEST_CASE(witness__extract_taproot__verified_same_key__reused)
+{
+    taproot::commitments batch{};
+    const auto instance = script_path();
+    BOOST_REQUIRE(instance.extract_commitment(batch, taproot_program()));
+    batch.front().valid = true;
+
+    // The verified commitment is not reverified.
+    hash_cptr out_leaf{};
+    script::cptr out_script{};
+    chunk_cptrs_ptr out_stack{};
+    BOOST_REQUIRE_EQUAL(instance.extract_taproot(out_leaf, out_script,
+        out_stack, taproot_program(), &batch.front()), error::script_success);
+    BOOST_REQUIRE_EQUAL(out_script, batch.front().leaf_script);
+    BOOST_REQUIRE_EQUAL(*out_leaf, batch.front().leaf);
+    BOOST_REQUIRE_EQUAL(out_stack->size(), one);
+}
+
+BOOST_AUTO_TEST_CASE(witness__extract_taproot__verified_other_key__verifies)
+{
+    taproot::commitments batch{};
+    const auto instance = script_path();
+    BOOST_REQUIRE(instance.extract_commitment(batch, taproot_program()));
+    batch.front().out_key = ec_xonly{ 0x24 };
+    batch.front().valid = true;
+
+    hash_cptr out_leaf{};
+    script::cptr out_script{};
+    chunk_cptrs_ptr out_stack{};
+    BOOST_REQUIRE_EQUAL(instance.extract_taproot(out_leaf, out_script,
+        out_stack, taproot_program(), &batch.front()),
+        error::invalid_commitment);
+}
+
+BOOST_AUTO_TEST_CASE(witness__extract_taproot__unverified__verifies)
+{
+    taproot::commitments batch{};
+    const auto instance = script_path();
+    BOOST_REQUIRE(instance.extract_commitment(batch, taproot_program()));
+
+    hash_cptr out_leaf{};
+    script::cptr out_script{};
+    chunk_cptrs_ptr out_stack{};
+    BOOST_REQUIRE_EQUAL(instance.extract_taproot(out_leaf, out_script,
+        out_stack, taproot_program(), &batch.front()),
+        error::invalid_commitment);
+}
+
 // json
 // ----------------------------------------------------------------------------
 
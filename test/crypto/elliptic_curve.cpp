@@ -147,6 +147,121 @@ BOOST_AUTO_TEST_CASE(elliptic_curve__verify_signature__negative__expected)
     BOOST_REQUIRE(!verify_signature(compressed2, sighash2, signature));
 }
 
+BOOST_AUTO_TEST_CASE(elliptic_curve__verify_signature__repeated_point__cache_hit)
+{
+    ec_signature signature;
+    BOOST_REQUIRE(parse_signature(signature, der_signature2, false));
+    BOOST_REQUIRE(verify_signature(compressed2, sighash2, signature));
+
+    const auto before = cache_statistics();
+    BOOST_REQUIRE(before.size > 0u);
+    BOOST_REQUIRE(verify_signature(compressed2, sighash2, signature));
+
+    // Cached point retains negative result.
+    signature[10] = 110;
+    BOOST_REQUIRE(!verify_signature(compressed2, sighash2, signature));
+
+    const auto after = cache_statistics();
+    BOOST_REQUIRE_EQUAL(after.hits, before.hits + 2u);
+    BOOST_REQUIRE_EQUAL(after.misses, before.misses);
+    BOOST_REQUIRE_EQUAL(after.size, before.size);
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__verify_signature__compressed_and_uncompressed__distinct_entries)
+{
+    const auto hash = bitcoin_hash(to_chunk("cache"));
+    ec_signature signature;
+    BOOST_REQUIRE(sign(signature, secret1, hash));
+    BOOST_REQUIRE(verify_signature(compressed1, hash, signature));
+    BOOST_REQUIRE(verify_signature(uncompressed1, hash, signature));
+
+    const auto before = cache_statistics();
+    BOOST_REQUIRE(verify_signature(compressed1, hash, signature));
+    BOOST_REQUIRE(verify_signature(uncompressed1, hash, signature));
+    BOOST_REQUIRE_EQUAL(cache_statistics().hits, before.hits + 2u);
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__verify_signature__padded_compressed_after_cached__false)
+{
+    const auto hash = bitcoin_hash(to_chunk("padded"));
+    ec_signature signature;
+    BOOST_REQUIRE(sign(signature, secret1, hash));
+
+    // Cache the compressed point.
+    BOOST_REQUIRE(verify_signature(compressed1, hash, signature));
+    BOOST_REQUIRE(verify_signature(compressed1, hash, signature));
+
+    // The compressed point zero padded to uncompressed size is not a valid
+    // encoding, and must not match the cached compressed point.
+    ec_uncompressed padded{};
+    std::copy(compressed1.begin(), compressed1.end(), padded.begin());
+    BOOST_REQUIRE(!verify_signature(padded, hash, signature));
+    BOOST_REQUIRE(!verify_signature(padded, hash, signature));
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__verify_signature__invalid_point__not_cached)
+{
+    ec_signature signature;
+    BOOST_REQUIRE(parse_signature(signature, der_signature2, false));
+
+    auto point = compressed2;
+    point.front() = 0x05;
+    const auto before = cache_statistics();
+    BOOST_REQUIRE(!verify_signature(point, sighash2, signature));
+    BOOST_REQUIRE(!verify_signature(point, sighash2, signature));
+
+    const auto after = cache_statistics();
+    BOOST_REQUIRE_EQUAL(after.hits, before.hits);
+    BOOST_REQUIRE_EQUAL(after.misses, before.misses + 2u);
+    BOOST_REQUIRE_EQUAL(after.size, before.size);
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__recover_candidates__signed__includes_signer)
+{
+    const auto hash = bitcoin_hash(to_chunk("candidates"));
+    ec_signature signature;
+    BOOST_REQUIRE(sign(signature, secret1, hash));
+
+    uncompressed_list candidates{};
+    BOOST_REQUIRE(recover_candidates(candidates, signature, hash));
+    BOOST_REQUIRE(!candidates.empty());
+    BOOST_REQUIRE(candidates.size() <= 4u);
+    BOOST_REQUIRE(std::find(candidates.begin(), candidates.end(),
+        uncompressed1) != candidates.end());
+
+    for (const auto& candidate: candidates)
+    {
+        BOOST_REQUIRE(verify_signature(candidate, hash, signature));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__recover_candidates__null_signature__empty)
+{
+    uncompressed_list candidates{ uncompressed1 };
+    BOOST_REQUIRE(recover_candidates(candidates, ec_signature{}, sighash2));
+    BOOST_REQUIRE(candidates.empty());
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__schnorr_verify_signature__repeated_point__cache_hit)
+{
+    ec_compressed point;
+    BOOST_REQUIRE(secret_to_public(point, secret3));
+    const auto& x_point = unsafe_array_cast<uint8_t, ec_xonly_size>(
+        std::next(point.data()));
+
+    ec_signature signature;
+    BOOST_REQUIRE(schnorr::sign(signature, secret3, sighash3, null_hash));
+    BOOST_REQUIRE(schnorr::verify_signature(x_point, sighash3, signature));
+
+    const auto before = schnorr::cache_statistics();
+    BOOST_REQUIRE(schnorr::verify_signature(x_point, sighash3, signature));
+    BOOST_REQUIRE(!schnorr::verify_signature(x_point, sighash2, signature));
+
+    const auto after = schnorr::cache_statistics();
+    BOOST_REQUIRE_EQUAL(after.hits, before.hits + 2u);
+    BOOST_REQUIRE_EQUAL(after.misses, before.misses);
+}
+
 // addition
 
 BOOST_AUTO_TEST_CASE(elliptic_curve__ec_add__positive__expected)
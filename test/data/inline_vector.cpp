@@ -0,0 +1,203 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(inline_vector_tests)
+
+BOOST_AUTO_TEST_CASE(inline_vector__construct__default__empty_inline)
+{
+    const inline_vector<uint32_t, 4> instance{};
+    BOOST_REQUIRE(instance.empty());
+    BOOST_REQUIRE(instance.is_inline());
+    BOOST_REQUIRE_EQUAL(instance.size(), zero);
+    BOOST_REQUIRE_EQUAL(instance.capacity(), 4u);
+}
+
+BOOST_AUTO_TEST_CASE(inline_vector__construct__size_within_inline__inline)
+{
+    const inline_vector<uint32_t, 4> instance(3);
+    BOOST_REQUIRE(instance.is_inline());
+    BOOST_REQUIRE_EQUAL(instance.size(), 3u);
+    BOOST_REQUIRE_EQUAL(instance[2], 0u);
+}
+
+BOOST_AUTO_TEST_CASE(inline_vector__construct__size_exceeds_inline__heap)
+{
+    const inline_vector<uint32_t, 4> instance(5);
+    BOOST_REQUIRE(!instance.is_inline());
+    BOOST_REQUIRE_EQUAL(instance.size(), 5u);
+    BOOST_REQUIRE_EQUAL(instance.capacity(), 5u);
+}
+
+BOOST_AUTO_TEST_CASE(inline_vector__push_back__beyond_inline__spills_ordered)
+{
+    inline_vector<uint32_t, 4> instance{};
+    for (uint32_t value = 0; value < 4u; ++value)
+        instance.push_back(value);
+
+    BOOST_REQUIRE(instance.is_inline());
+    instance.push_back(4);
+    BOOST_REQUIRE(!instance.is_inline());
+    BOOST_REQUIRE_EQUAL(instance.capacity(), 8u);
+    BOOST_REQUIRE_EQUAL(instance.size(), 5u);
+
+    for (uint32_t value = 0; value < 5u; ++value)
+        BOOST_REQUIRE_EQUAL(instance[value], value);
+}
+
+BOOST_AUTO_TEST_CASE(inline_vector__pop_back__spilled__retains_heap)
+{
+    inline_vector<uint32_t, 2> instance{};
+    instance.push_back(1);
+    instance.push_back(2);
+    instance.push_back(3);
+    instance.pop_back();
+    instance.pop_back();
+    BOOST_REQUIRE(!instance.is_inline());
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+    BOOST_REQUIRE_EQUAL(instance.back(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(inline_vector__emplace_back__value__returns_element)
+{
+    inline_vector<uint32_t, 2> instance{};
+    auto& element = instance.emplace_back(42u);
+    BOOST_REQUIRE_EQUAL(element, 42u);
+    BOOST_REQUIRE_EQUAL(instance.back(), 42u);
+}
+
+BOOST_AUTO_TEST_CASE(inline_vector__erase__middle__shifted)
+{
+    inline_vector<uint32_t, 4> instance{};
+    instance.push_back(1);
+    instance.push_back(2);
+    instance.push_back(3);
+    const auto it = instance.erase(std::next(instance.begin()));
+    BOOST_REQUIRE_EQUAL(*it, 3u);
+    BOOST_REQUIRE_EQUAL(instance.size(), 2u);
+    BOOST_REQUIRE_EQUAL(instance[0], 1u);
+    BOOST_REQUIRE_EQUAL(instance[1], 3u);
+}
+
+BOOST_AUTO_TEST_CASE(inline_vector__erase__last__end)
+{
+    inline_vector<uint32_t, 4> instance{};
+    instance.push_back(1);
+    instance.push_back(2);
+    BOOST_REQUIRE(instance.erase(std::prev(instance.end())) == instance.end());
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(inline_vector__copy__inline__independent)
+{
+    inline_vector<uint32_t, 4> instance{};
+    instance.push_back(1);
+    auto copy{ instance };
+    copy.push_back(2);
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+    BOOST_REQUIRE_EQUAL(copy.size(), 2u);
+    BOOST_REQUIRE(copy.data() != instance.data());
+}
+
+BOOST_AUTO_TEST_CASE(inline_vector__move__spilled__preserved)
+{
+    inline_vector<uint32_t, 1> instance{};
+    instance.push_back(1);
+    instance.push_back(2);
+    const auto moved{ std::move(instance) };
+    BOOST_REQUIRE(!moved.is_inline());
+    BOOST_REQUIRE_EQUAL(moved.size(), 2u);
+    BOOST_REQUIRE_EQUAL(moved[0], 1u);
+    BOOST_REQUIRE_EQUAL(moved[1], 2u);
+}
+
+BOOST_AUTO_TEST_CASE(inline_vector__move__spilled__source_empty_inline_usable)
+{
+    inline_vector<uint32_t, 2> instance{};
+    instance.push_back(1);
+    instance.push_back(2);
+    instance.push_back(3);
+    const auto moved{ std::move(instance) };
+    BOOST_REQUIRE_EQUAL(moved.size(), 3u);
+
+    BOOST_REQUIRE(instance.empty());
+    BOOST_REQUIRE(instance.is_inline());
+    BOOST_REQUIRE_EQUAL(instance.capacity(), 2u);
+    BOOST_REQUIRE(instance.begin() == instance.end());
+
+    instance.push_back(4);
+    instance.push_back(5);
+    instance.push_back(6);
+    BOOST_REQUIRE_EQUAL(instance.size(), 3u);
+    BOOST_REQUIRE_EQUAL(instance.back(), 6u);
+    instance.pop_back();
+    BOOST_REQUIRE_EQUAL(instance.back(), 5u);
+    BOOST_REQUIRE_EQUAL(moved[2], 3u);
+}
+
+BOOST_AUTO_TEST_CASE(inline_vector__move_assign__inline_over_spilled__source_empty)
+{
+    inline_vector<uint32_t, 2> instance{};
+    instance.push_back(1);
+    inline_vector<uint32_t, 2> target{};
+    target.push_back(7);
+    target.push_back(8);
+    target.push_back(9);
+    target = std::move(instance);
+    BOOST_REQUIRE(target.is_inline());
+    BOOST_REQUIRE_EQUAL(target.size(), 1u);
+    BOOST_REQUIRE_EQUAL(target[0], 1u);
+    BOOST_REQUIRE(instance.empty());
+    BOOST_REQUIRE(instance.is_inline());
+}
+
+BOOST_AUTO_TEST_CASE(inline_vector__copy_assign__spilled__independent)
+{
+    inline_vector<uint32_t, 1> instance{};
+    instance.push_back(1);
+    instance.push_back(2);
+    inline_vector<uint32_t, 1> copy{};
+    copy = instance;
+    copy.push_back(3);
+    BOOST_REQUIRE(!copy.is_inline());
+    BOOST_REQUIRE_EQUAL(instance.size(), 2u);
+    BOOST_REQUIRE_EQUAL(copy.size(), 3u);
+    BOOST_REQUIRE_EQUAL(copy[1], 2u);
+    BOOST_REQUIRE(copy.data() != instance.data());
+}
+
+BOOST_AUTO_TEST_CASE(inline_vector__projection__chunk__expected)
+{
+    const auto result = projection<inline_vector<uint32_t, 2>>(data_chunk{ 1, 2, 3 });
+    BOOST_REQUIRE_EQUAL(result.size(), 3u);
+    BOOST_REQUIRE_EQUAL(result[0], 1u);
+    BOOST_REQUIRE_EQUAL(result[2], 3u);
+}
+
+BOOST_AUTO_TEST_CASE(inline_vector__clear__spilled__empty)
+{
+    inline_vector<uint32_t, 1> instance{};
+    instance.push_back(1);
+    instance.push_back(2);
+    instance.clear();
+    BOOST_REQUIRE(instance.empty());
+    BOOST_REQUIRE(instance.begin() == instance.end());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,100 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+#include <atomic>
+#include <thread>
+
+BOOST_AUTO_TEST_SUITE(once_cache_tests)
+
+BOOST_AUTO_TEST_CASE(once_cache__construct__default__unset)
+{
+    const once_cache<uint32_t> instance{};
+    BOOST_REQUIRE(!instance);
+}
+
+BOOST_AUTO_TEST_CASE(once_cache__get__unset__computed_once)
+{
+    size_t calls{};
+    once_cache<uint32_t> instance{};
+    BOOST_REQUIRE_EQUAL(instance.get([&]() NOEXCEPT { ++calls; return 42u; }), 42u);
+    BOOST_REQUIRE_EQUAL(instance.get([&]() NOEXCEPT { ++calls; return 24u; }), 42u);
+    BOOST_REQUIRE_EQUAL(calls, one);
+    BOOST_REQUIRE(instance);
+    BOOST_REQUIRE_EQUAL(*instance, 42u);
+}
+
+BOOST_AUTO_TEST_CASE(once_cache__set__set__replaced)
+{
+    once_cache<uint32_t> instance{};
+    instance.set(42u);
+    BOOST_REQUIRE(instance);
+    BOOST_REQUIRE_EQUAL(*instance, 42u);
+
+    instance.set(24u);
+    BOOST_REQUIRE_EQUAL(instance.get([]() NOEXCEPT { return 42u; }), 24u);
+}
+
+BOOST_AUTO_TEST_CASE(once_cache__copy__set_and_unset__expected)
+{
+    once_cache<uint32_t> set{};
+    set.set(42u);
+    const once_cache<uint32_t> unset{};
+
+    const auto copy_set = set;
+    const auto copy_unset = unset;
+    BOOST_REQUIRE(copy_set);
+    BOOST_REQUIRE_EQUAL(*copy_set, 42u);
+    BOOST_REQUIRE(!copy_unset);
+
+    set = copy_unset;
+    BOOST_REQUIRE(!set);
+}
+
+BOOST_AUTO_TEST_CASE(once_cache__get__concurrent__computed_once_same_reference)
+{
+    constexpr size_t threads = 8;
+    std::atomic<size_t> calls{};
+    std::atomic<size_t> ready{};
+    once_cache<hash_digest> instance{};
+    std::array<const hash_digest*, threads> results{};
+    std_vector<std::thread> workers{};
+
+    for (size_t thread = 0; thread < threads; ++thread)
+    {
+        workers.emplace_back([&, thread]() NOEXCEPT
+        {
+            ++ready;
+            while (ready < threads) std::this_thread::yield();
+            results.at(thread) = &instance.get([&]() NOEXCEPT
+            {
+                ++calls;
+                return sha256_hash(data_chunk{ 0x42 });
+            });
+        });
+    }
+
+    for (auto& worker: workers)
+        worker.join();
+
+    BOOST_REQUIRE_EQUAL(calls, one);
+    for (const auto result: results)
+        BOOST_REQUIRE_EQUAL(result, &(*instance));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,237 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(ring_buffer_tests)
+
+BOOST_AUTO_TEST_CASE(ring_buffer__construct__default__empty)
+{
+    const ring_buffer<uint32_t> instance{};
+    BOOST_REQUIRE(instance.empty());
+    BOOST_REQUIRE_EQUAL(instance.size(), zero);
+    BOOST_REQUIRE_EQUAL(instance.capacity(), zero);
+}
+
+BOOST_AUTO_TEST_CASE(ring_buffer__construct__capacity__power_of_two)
+{
+    const ring_buffer<uint32_t> instance(11);
+    BOOST_REQUIRE(instance.empty());
+    BOOST_REQUIRE_EQUAL(instance.capacity(), 16u);
+}
+
+BOOST_AUTO_TEST_CASE(ring_buffer__construct__initializer_list__ordered)
+{
+    const ring_buffer<uint32_t> instance{ 1, 2, 3 };
+    BOOST_REQUIRE_EQUAL(instance.size(), 3u);
+    BOOST_REQUIRE_EQUAL(instance.front(), 1u);
+    BOOST_REQUIRE_EQUAL(instance.back(), 3u);
+    BOOST_REQUIRE_EQUAL(instance[1], 2u);
+}
+
+BOOST_AUTO_TEST_CASE(ring_buffer__push_back__default__grows)
+{
+    ring_buffer<uint32_t> instance{};
+    for (uint32_t value = 0; value < 5u; ++value)
+        instance.push_back(value);
+
+    BOOST_REQUIRE_EQUAL(instance.size(), 5u);
+    BOOST_REQUIRE_EQUAL(instance.capacity(), 8u);
+    BOOST_REQUIRE_EQUAL(instance.front(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.back(), 4u);
+}
+
+BOOST_AUTO_TEST_CASE(ring_buffer__push_back_pop_front__reserved_window__wraps_without_growth)
+{
+    ring_buffer<uint32_t> instance(4);
+    for (uint32_t value = 0; value < 100u; ++value)
+    {
+        instance.push_back(value);
+        if (instance.size() > 3u)
+            instance.pop_front();
+    }
+
+    BOOST_REQUIRE_EQUAL(instance.capacity(), 4u);
+    BOOST_REQUIRE_EQUAL(instance.size(), 3u);
+    BOOST_REQUIRE_EQUAL(instance[0], 97u);
+    BOOST_REQUIRE_EQUAL(instance[1], 98u);
+    BOOST_REQUIRE_EQUAL(instance[2], 99u);
+}
+
+BOOST_AUTO_TEST_CASE(ring_buffer__reserve__wrapped__linearized)
+{
+    ring_buffer<uint32_t> instance(4);
+    instance.push_back(1);
+    instance.push_back(2);
+    instance.push_back(3);
+    instance.pop_front();
+    instance.pop_front();
+    instance.push_back(4);
+    instance.push_back(5);
+    instance.reserve(5);
+    BOOST_REQUIRE_EQUAL(instance.capacity(), 8u);
+    BOOST_REQUIRE(instance == ring_buffer<uint32_t>({ 3, 4, 5 }));
+}
+
+BOOST_AUTO_TEST_CASE(ring_buffer__pop_back__non_empty__removes_newest)
+{
+    ring_buffer<uint32_t> instance{ 1, 2, 3 };
+    instance.pop_back();
+    BOOST_REQUIRE_EQUAL(instance.size(), 2u);
+    BOOST_REQUIRE_EQUAL(instance.back(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(ring_buffer__clear__non_empty__empty_capacity_retained)
+{
+    ring_buffer<uint32_t> instance{ 1, 2, 3 };
+    instance.clear();
+    BOOST_REQUIRE(instance.empty());
+    BOOST_REQUIRE_EQUAL(instance.capacity(), 4u);
+}
+
+BOOST_AUTO_TEST_CASE(ring_buffer__iterators__wrapped__ordered)
+{
+    ring_buffer<uint32_t> instance(4);
+    for (uint32_t value = 0; value < 6u; ++value)
+    {
+        instance.push_back(value);
+        if (instance.size() > 4u)
+            instance.pop_front();
+    }
+
+    const std_vector<uint32_t> forward(instance.begin(), instance.end());
+    const std_vector<uint32_t> reverse(instance.crbegin(), instance.crend());
+    BOOST_REQUIRE(forward == std_vector<uint32_t>({ 2, 3, 4, 5 }));
+    BOOST_REQUIRE(reverse == std_vector<uint32_t>({ 5, 4, 3, 2 }));
+    BOOST_REQUIRE_EQUAL(*std::next(instance.crbegin()), 4u);
+    BOOST_REQUIRE_EQUAL(std::distance(instance.begin(), instance.end()), 4);
+}
+
+BOOST_AUTO_TEST_CASE(ring_buffer__push_front__default__grows_ordered)
+{
+    ring_buffer<uint32_t> instance{};
+    for (uint32_t value = 0; value < 5u; ++value)
+        instance.push_front(value);
+
+    BOOST_REQUIRE_EQUAL(instance.size(), 5u);
+    BOOST_REQUIRE_EQUAL(instance.capacity(), 8u);
+    BOOST_REQUIRE(instance == ring_buffer<uint32_t>({ 4, 3, 2, 1, 0 }));
+}
+
+BOOST_AUTO_TEST_CASE(ring_buffer__push_front_pop_back__reserved_window__wraps_without_growth)
+{
+    ring_buffer<uint32_t> instance(4);
+    for (uint32_t value = 0; value < 10u; ++value)
+    {
+        instance.push_front(value);
+        if (instance.size() > 3u)
+            instance.pop_back();
+    }
+
+    BOOST_REQUIRE_EQUAL(instance.capacity(), 4u);
+    BOOST_REQUIRE(instance == ring_buffer<uint32_t>({ 9, 8, 7 }));
+}
+
+BOOST_AUTO_TEST_CASE(ring_buffer__push_front_push_back__mixed__ordered)
+{
+    ring_buffer<uint32_t> instance(2);
+    instance.push_back(2);
+    instance.push_front(1);
+    instance.push_back(3);
+    instance.push_front(0);
+    BOOST_REQUIRE_EQUAL(instance.capacity(), 4u);
+    BOOST_REQUIRE(instance == ring_buffer<uint32_t>({ 0, 1, 2, 3 }));
+}
+
+BOOST_AUTO_TEST_CASE(ring_buffer__resize__larger__default_appended)
+{
+    ring_buffer<uint32_t> instance{ 1, 2 };
+    instance.resize(5);
+    BOOST_REQUIRE_EQUAL(instance.capacity(), 8u);
+    BOOST_REQUIRE(instance == ring_buffer<uint32_t>({ 1, 2, 0, 0, 0 }));
+}
+
+BOOST_AUTO_TEST_CASE(ring_buffer__resize__larger_value__value_appended)
+{
+    ring_buffer<uint32_t> instance{ 1 };
+    instance.resize(3, 42);
+    BOOST_REQUIRE(instance == ring_buffer<uint32_t>({ 1, 42, 42 }));
+}
+
+BOOST_AUTO_TEST_CASE(ring_buffer__resize__smaller_wrapped__back_removed)
+{
+    ring_buffer<uint32_t> instance(4);
+    instance.push_back(0);
+    instance.push_back(1);
+    instance.pop_front();
+    instance.push_back(2);
+    instance.push_back(3);
+    instance.push_back(4);
+    instance.resize(2);
+    BOOST_REQUIRE_EQUAL(instance.capacity(), 4u);
+    BOOST_REQUIRE(instance == ring_buffer<uint32_t>({ 1, 2 }));
+}
+
+BOOST_AUTO_TEST_CASE(ring_buffer__insert__value_middle__inserted_ordered)
+{
+    ring_buffer<uint32_t> instance{ 1, 2, 4 };
+    const auto it = instance.insert(std::next(instance.cbegin(), 2), 3);
+    BOOST_REQUIRE_EQUAL(*it, 3u);
+    BOOST_REQUIRE(instance == ring_buffer<uint32_t>({ 1, 2, 3, 4 }));
+}
+
+BOOST_AUTO_TEST_CASE(ring_buffer__insert__range_front_wrapped__inserted_ordered)
+{
+    ring_buffer<uint32_t> instance(8);
+    instance.push_back(0);
+    instance.pop_front();
+    instance.push_front(4);
+    instance.push_back(5);
+    const std_vector<uint32_t> values{ 1, 2, 3 };
+    const auto it = instance.insert(instance.cbegin(), values.begin(),
+        values.end());
+    BOOST_REQUIRE(it == instance.begin());
+    BOOST_REQUIRE_EQUAL(instance.capacity(), 8u);
+    BOOST_REQUIRE(instance == ring_buffer<uint32_t>({ 1, 2, 3, 4, 5 }));
+}
+
+BOOST_AUTO_TEST_CASE(ring_buffer__insert__empty_range_end__unchanged)
+{
+    ring_buffer<uint32_t> instance{ 1, 2 };
+    const std_vector<uint32_t> values{};
+    const auto it = instance.insert(instance.cend(), values.begin(),
+        values.end());
+    BOOST_REQUIRE(it == instance.end());
+    BOOST_REQUIRE(instance == ring_buffer<uint32_t>({ 1, 2 }));
+}
+
+BOOST_AUTO_TEST_CASE(ring_buffer__copy__wrapped__equal_capacity_retained)
+{
+    ring_buffer<uint32_t> instance(4);
+    instance.push_back(1);
+    instance.pop_front();
+    instance.push_back(2);
+    const auto copy{ instance };
+    BOOST_REQUIRE(copy == instance);
+    BOOST_REQUIRE_EQUAL(copy.capacity(), 4u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+static_assert(std::random_access_iterator<ring_buffer<uint32_t>::iterator>);
+static_assert(std::random_access_iterator<ring_buffer<uint32_t>::const_iterator>);
@@ -49,4 +49,13 @@ BOOST_AUTO_TEST_CASE(error_t__code__not_implemented__true_exected_message)
     BOOST_REQUIRE_EQUAL(ec.message(), "feature not implemented");
 }
 
+BOOST_AUTO_TEST_CASE(error_t__code__invalid_frame__true_exected_message)
+{
+    constexpr auto value = error::invalid_frame;
+    const auto ec = code(value);
+    BOOST_REQUIRE(ec);
+    BOOST_REQUIRE(ec == value);
+    BOOST_REQUIRE_EQUAL(ec.message(), "invalid framed object");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -21,9 +21,96 @@
 
 BOOST_AUTO_TEST_SUITE(golomb_tests)
 
-BOOST_AUTO_TEST_CASE(golomb_test)
+constexpr uint8_t golomb_bits = 19;
+constexpr uint64_t golomb_rate = 784931;
+static const siphash_key golomb_key{ 0x0123456789abcdef, 0xfedcba9876543210 };
+static const data_stack golomb_items
 {
-    BOOST_REQUIRE(true);
+    { 0x00 }, { 0x01, 0x02 }, { 0x2a, 0x2a, 0x2a }, base16_chunk("deadbeef"),
+    base16_chunk("76a914000000000000000000000000000000000000000088ac")
+};
+
+BOOST_AUTO_TEST_CASE(golomb__construct__word_writer__equals_bit_writer)
+{
+    data_chunk expected{};
+    {
+        write::bits::data writer(expected);
+        golomb::construct(writer, golomb_items, golomb_bits, golomb_key,
+            golomb_rate);
+    }
+
+    const auto set = golomb::construct(golomb_items, golomb_bits, golomb_key,
+        golomb_rate);
+    BOOST_REQUIRE(!set.empty());
+    BOOST_REQUIRE_EQUAL(set, expected);
+}
+
+BOOST_AUTO_TEST_CASE(golomb__match_single__constructed__expected)
+{
+    const auto size = golomb_items.size();
+    const auto set = golomb::construct(golomb_items, golomb_bits, golomb_key,
+        golomb_rate);
+
+    for (const auto& item: golomb_items)
+        BOOST_REQUIRE(golomb::match_single(set, item, size, golomb_key,
+            golomb_bits, golomb_rate));
+
+    BOOST_REQUIRE(!golomb::match_single(set, { 0x03 }, size, golomb_key,
+        golomb_bits, golomb_rate));
+}
+
+BOOST_AUTO_TEST_CASE(golomb__match_single__bit_reader__equals_word_reader)
+{
+    const auto size = golomb_items.size();
+    const auto set = golomb::construct(golomb_items, golomb_bits, golomb_key,
+        golomb_rate);
+
+    for (const auto& item: golomb_items)
+    {
+        read::bits::copy reader(set);
+        BOOST_REQUIRE(golomb::match_single(reader, item, size, golomb_key,
+            golomb_bits, golomb_rate));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(golomb__match_stack__constructed__expected)
+{
+    const auto size = golomb_items.size();
+    const auto set = golomb::construct(golomb_items, golomb_bits, golomb_key,
+        golomb_rate);
+
+    BOOST_REQUIRE(golomb::match_stack(set, { { 0x03 }, golomb_items[2] },
+        size, golomb_key, golomb_bits, golomb_rate));
+    BOOST_REQUIRE(!golomb::match_stack(set, { { 0x03 }, { 0x04 } },
+        size, golomb_key, golomb_bits, golomb_rate));
+}
+
+BOOST_AUTO_TEST_CASE(golomb__distinct_set__duplicate_slices__equals_distinct_construct)
+{
+    std::vector<data_slice> slices{};
+    for (const auto& item: golomb_items)
+    {
+        slices.emplace_back(item);
+        slices.emplace_back(item);
+    }
+
+    const auto set = golomb::distinct_set(slices, golomb_key, golomb_rate);
+    BOOST_REQUIRE_EQUAL(set.size(), golomb_items.size());
+    BOOST_REQUIRE(std::is_sorted(set.begin(), set.end()));
+
+    data_chunk out{};
+    {
+        write::bits::word writer(out);
+        golomb::construct(writer, set, golomb_bits);
+    }
+
+    BOOST_REQUIRE_EQUAL(out, golomb::construct(golomb_items, golomb_bits,
+        golomb_key, golomb_rate));
+}
+
+BOOST_AUTO_TEST_CASE(golomb__distinct_set__empty__empty)
+{
+    BOOST_REQUIRE(golomb::distinct_set({}, golomb_key, golomb_rate).empty());
 }
 
 BOOST_AUTO_TEST_SUITE_END()
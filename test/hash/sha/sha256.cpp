@@ -343,4 +343,47 @@ BOOST_AUTO_TEST_CASE(sha256__merkle_root__four__expected)
     BOOST_CHECK_EQUAL(sha256::merkle_root({ { 0 }, { 1 }, { 2 }, { 3 } }), expected);
 }
 
+// sha256::tagged_hash
+BOOST_AUTO_TEST_CASE(sha256__tagged_hash__empty__empty)
+{
+    constexpr auto midstate = hash::sha256t::fast<"TapBranch">::midstate();
+    sha256::digests_t digests{};
+    sha256::tagged_hash(digests, midstate);
+    BOOST_REQUIRE(digests.empty());
+}
+
+BOOST_AUTO_TEST_CASE(sha256__tagged_hash__two__expected)
+{
+    constexpr auto midstate = hash::sha256t::fast<"TapBranch">::midstate();
+    const auto tag = sha256_hash(to_chunk(std::string{ "TapBranch" }));
+    const auto expected = sha256_hash(splice(splice(tag, tag),
+        splice(sha256::digest_t{ 0 }, sha256::digest_t{ 1 })));
+    sha256::digests_t digests{ { 0 }, { 1 } };
+    sha256::tagged_hash(digests, midstate);
+    BOOST_REQUIRE_EQUAL(digests.size(), one);
+    BOOST_REQUIRE_EQUAL(digests.front(), expected);
+}
+
+BOOST_AUTO_TEST_CASE(sha256__tagged_hash__many__expected)
+{
+    // Sufficient pairs for all vector lanes and a normal form remainder.
+    constexpr auto pairs = 37u;
+    constexpr auto midstate = hash::sha256t::fast<"TapTweak">::midstate();
+    const auto tag = sha256_hash(to_chunk(std::string{ "TapTweak" }));
+    sha256::digests_t digests(pairs * two);
+    for (size_t index = 0; index < digests.size(); ++index)
+        digests[index] = sha256::digest_t{ narrow_cast<uint8_t>(index) };
+
+    const auto copy = digests;
+    sha256::tagged_hash(digests, midstate);
+    BOOST_REQUIRE_EQUAL(digests.size(), pairs);
+
+    for (size_t index = 0; index < pairs; ++index)
+    {
+        const auto expected = sha256_hash(splice(splice(tag, tag),
+            splice(copy[index * two], copy[add1(index * two)])));
+        BOOST_REQUIRE_EQUAL(digests[index], expected);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -74,4 +74,59 @@ BOOST_AUTO_TEST_CASE(siphash__key__vectors__expected)
     }
 }
 
+BOOST_AUTO_TEST_CASE(siphash__batch__vectors__expected)
+{
+    half_hash hash{};
+    BOOST_REQUIRE(decode_base16(hash, hash_test_key));
+
+    const auto key = to_siphash_key(hash);
+    data_stack messages{};
+    std::vector<uint64_t> expected{};
+
+    for (const auto& result: siphash_hash_tests)
+    {
+        data_chunk data;
+        BOOST_REQUIRE(decode_base16(data, result.message));
+        messages.push_back(data);
+
+        data_chunk encoded_expected;
+        BOOST_REQUIRE(decode_base16(encoded_expected, result.result));
+        expected.push_back(from_little_endian<uint64_t>(encoded_expected));
+    }
+
+    std::vector<uint64_t> hashes{};
+    siphash(hashes, key, messages);
+    BOOST_REQUIRE_EQUAL(hashes.size(), expected.size());
+    BOOST_REQUIRE(hashes == expected);
+}
+
+BOOST_AUTO_TEST_CASE(siphash__batch__partial_group_mixed_lengths__expected)
+{
+    const siphash_key key{ 0x0706050403020100, 0x0f0e0d0c0b0a0908 };
+    const data_stack chunks
+    {
+        base16_chunk("0001020304050607080910111213141516171819202122"),
+        base16_chunk(""),
+        base16_chunk("00010203040506070809101112131415"),
+        base16_chunk("0001020304"),
+        base16_chunk("000102030405060708091011121314151617181920212223"),
+        base16_chunk("00010203040506070809101112")
+    };
+
+    const std::vector<data_slice> messages(chunks.begin(), chunks.end());
+    std::vector<uint64_t> hashes{};
+    siphash(hashes, key, messages);
+    BOOST_REQUIRE_EQUAL(hashes.size(), messages.size());
+
+    for (size_t index = 0; index < messages.size(); ++index)
+        BOOST_REQUIRE_EQUAL(hashes.at(index), siphash(key, messages.at(index)));
+}
+
+BOOST_AUTO_TEST_CASE(siphash__batch__empty__empty)
+{
+    std::vector<uint64_t> hashes{ 42 };
+    siphash(hashes, siphash_key{ 1, 2 }, data_stack{});
+    BOOST_REQUIRE(hashes.empty());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -17,12 +17,628 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include "../test.hpp"
+#include "machine.hpp"
 
 BOOST_AUTO_TEST_SUITE(interpreter_tests)
 
-BOOST_AUTO_TEST_CASE(interpreter_test)
+using namespace system::chain;
+using namespace system::machine;
+
+class accessor
+  : public interpreter<contiguous_stack>
+{
+public:
+    static bool connect_standard(code& ec, uint32_t active_flags,
+        const transaction& tx, uint32_t index=0) NOEXCEPT
+    {
+        return interpreter::connect_standard(ec, { active_flags }, tx,
+            std::next(tx.inputs_ptr()->begin(), index));
+    }
+
+    static code connect_generic(uint32_t active_flags,
+        const transaction& tx, uint32_t index=0) NOEXCEPT
+    {
+        return interpreter::connect_generic({ active_flags }, tx,
+            std::next(tx.inputs_ptr()->begin(), index));
+    }
+
+    static bool verify_ecdsa(const data_slice& point, const hash_digest& hash,
+        const ec_signature& signature) NOEXCEPT
+    {
+        return interpreter::verify_ecdsa(point, hash, signature);
+    }
+
+    static bool recover_ecdsa(uncompressed_list& out, const hash_digest& hash,
+        const ec_signature& signature) NOEXCEPT
+    {
+        return interpreter::recover_ecdsa(out, hash, signature);
+    }
+
+    static bool match_ecdsa(const data_chunk& point,
+        const uncompressed_list& candidates, const hash_digest& hash,
+        const ec_signature& signature) NOEXCEPT
+    {
+        return interpreter::match_ecdsa(point, candidates, hash, signature);
+    }
+};
+
+constexpr auto segwit_flags = flags::bip141_rule | flags::bip143_rule;
+constexpr auto taproot_flags = segwit_flags | flags::bip341_rule |
+    flags::bip342_rule;
+
+script pushes(const data_chunk& first, const data_chunk& second) NOEXCEPT
+{
+    return script{ "[" + encode_base16(first) + "] [" +
+        encode_base16(second) + "]" };
+}
+
+// Handled by the standard path, with the generic path result.
+code connect(uint32_t active_flags, const transaction& tx,
+    uint32_t index=0) NOEXCEPT
 {
-    BOOST_REQUIRE(true);
+    code ec{};
+    BOOST_REQUIRE(accessor::connect_standard(ec, active_flags, tx, index));
+    BOOST_REQUIRE_EQUAL(ec, accessor::connect_generic(active_flags, tx, index));
+    BOOST_REQUIRE_EQUAL(ec, interpreter<linked_stack>::connect(
+        { active_flags }, tx, index));
+    return ec;
+}
+
+code connect_generic(uint32_t active_flags, const transaction& tx) NOEXCEPT
+{
+    return accessor::connect_generic(active_flags, tx);
+}
+
+bool is_standard(uint32_t active_flags, const transaction& tx) NOEXCEPT
+{
+    code ec{};
+    return accessor::connect_standard(ec, active_flags, tx);
+}
+
+// p2pkh
+
+BOOST_AUTO_TEST_CASE(interpreter__connect_standard__key_hash_signed__success)
+{
+    const auto point = public_key(secret);
+    const script prevout{ script::to_pay_key_hash_pattern(
+        bitcoin_short_hash(point)) };
+    const auto sig = sign(secret, prevout, script_version::unversioned,
+        flags::no_rules);
+
+    const auto tx = spend(prevout, pushes(sig, to_chunk(point)), {});
+    BOOST_REQUIRE_EQUAL(connect(flags::no_rules, tx), error::script_success);
+    BOOST_REQUIRE_EQUAL(connect(flags::all_rules, tx), error::script_success);
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect_standard__key_hash_wrong_signer__stack_false)
+{
+    const auto point = public_key(secret);
+    const script prevout{ script::to_pay_key_hash_pattern(
+        bitcoin_short_hash(point)) };
+    const auto sig = sign(other_secret, prevout, script_version::unversioned,
+        flags::no_rules);
+
+    const auto tx = spend(prevout, pushes(sig, to_chunk(point)), {});
+    BOOST_REQUIRE_EQUAL(connect(flags::all_rules, tx), error::stack_false);
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect_standard__key_hash_wrong_key__op_equal_verify2)
+{
+    const auto point = public_key(other_secret);
+    const script prevout{ script::to_pay_key_hash_pattern(
+        bitcoin_short_hash(public_key(secret))) };
+    const auto sig = sign(other_secret, prevout, script_version::unversioned,
+        flags::no_rules);
+
+    const auto tx = spend(prevout, pushes(sig, to_chunk(point)), {});
+    BOOST_REQUIRE_EQUAL(connect(flags::all_rules, tx), error::op_equal_verify2);
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect_standard__key_hash_invalid_der__bip66_dependent)
+{
+    const auto point = public_key(secret);
+    const script prevout{ script::to_pay_key_hash_pattern(
+        bitcoin_short_hash(point)) };
+
+    const auto tx = spend(prevout, pushes({ 0x30, 0x01 }, to_chunk(point)), {});
+    BOOST_REQUIRE_EQUAL(connect(flags::bip66_rule, tx), error::op_check_sig_parse_signature);
+    BOOST_REQUIRE_EQUAL(connect(flags::no_rules, tx), error::stack_false);
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect_standard__key_hash_nonstandard__not_handled)
+{
+    const auto point = public_key(secret);
+    const script prevout{ script::to_pay_key_hash_pattern(
+        bitcoin_short_hash(point)) };
+    const auto sig = sign(secret, prevout, script_version::unversioned,
+        flags::no_rules);
+    const auto key = encode_base16(point);
+
+    // Witness present.
+    BOOST_REQUIRE(!is_standard(flags::all_rules,
+        spend(prevout, pushes(sig, to_chunk(point)), { sig })));
+
+    // Number push.
+    BOOST_REQUIRE(!is_standard(flags::all_rules,
+        spend(prevout, script{ "0 [" + key + "]" }, {})));
+
+    // Three pushes.
+    BOOST_REQUIRE(!is_standard(flags::all_rules,
+        spend(prevout, script{ "[00] [00] [" + key + "]" }, {})));
+
+    // Non-minimal prevout hash push.
+    const auto hash = encode_base16(bitcoin_short_hash(point));
+    BOOST_REQUIRE(!is_standard(flags::all_rules, spend(script{ "dup hash160 "
+        "[1." + hash + "] equalverify checksig" }, pushes(sig, to_chunk(point)),
+        {})));
+}
+
+// p2wpkh
+
+BOOST_AUTO_TEST_CASE(interpreter__connect_standard__witness_key_hash_signed__success)
+{
+    const auto point = public_key(secret);
+    const auto hash = bitcoin_short_hash(point);
+    const script prevout{ script::to_pay_witness_key_hash_pattern(hash) };
+    const script subscript{ script::to_pay_key_hash_pattern(hash) };
+    const auto sig = sign(secret, subscript, script_version::segwit,
+        segwit_flags);
+
+    const auto tx = spend(prevout, {}, { sig, to_chunk(point) });
+    BOOST_REQUIRE_EQUAL(connect(segwit_flags, tx), error::script_success);
+    BOOST_REQUIRE_EQUAL(connect(flags::all_rules, tx), error::script_success);
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect_standard__witness_key_hash_wrong_value__stack_false)
+{
+    const auto point = public_key(secret);
+    const auto hash = bitcoin_short_hash(point);
+    const script prevout{ script::to_pay_witness_key_hash_pattern(hash) };
+    const script subscript{ script::to_pay_key_hash_pattern(hash) };
+    const auto sig = sign(secret, subscript, script_version::segwit,
+        segwit_flags);
+
+    const auto tx = spend(prevout, {}, { sig, to_chunk(point) }, add1(value));
+    BOOST_REQUIRE_EQUAL(connect(segwit_flags, tx), error::stack_false);
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect_standard__witness_key_hash_wrong_key__op_equal_verify2)
+{
+    const auto point = public_key(other_secret);
+    const auto hash = bitcoin_short_hash(public_key(secret));
+    const script prevout{ script::to_pay_witness_key_hash_pattern(hash) };
+    const script subscript{ script::to_pay_key_hash_pattern(hash) };
+    const auto sig = sign(other_secret, subscript, script_version::segwit,
+        segwit_flags);
+
+    const auto tx = spend(prevout, {}, { sig, to_chunk(point) });
+    BOOST_REQUIRE_EQUAL(connect(segwit_flags, tx), error::op_equal_verify2);
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect_standard__witness_key_hash_oversized_element__invalid_witness_stack)
+{
+    const auto point = public_key(secret);
+    const script prevout{ script::to_pay_witness_key_hash_pattern(
+        bitcoin_short_hash(point)) };
+
+    const data_chunk sig(add1(max_push_data_size), 0x42);
+    const auto tx = spend(prevout, {}, { sig, to_chunk(point) });
+    BOOST_REQUIRE_EQUAL(connect(segwit_flags, tx), error::invalid_witness_stack);
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect_standard__witness_key_hash_nonstandard__not_handled)
+{
+    const auto point = public_key(secret);
+    const script prevout{ script::to_pay_witness_key_hash_pattern(
+        bitcoin_short_hash(point)) };
+    const auto key = to_chunk(point);
+
+    // Witness rules inactive.
+    BOOST_REQUIRE(!is_standard(flags::no_rules, spend(prevout, {}, { key, key })));
+
+    // Three element witness.
+    BOOST_REQUIRE(!is_standard(segwit_flags, spend(prevout, {}, { key, key, key })));
+
+    // Dirty input script.
+    BOOST_REQUIRE(!is_standard(segwit_flags, spend(prevout, script{ "0" }, { key, key })));
+
+    // False witness program.
+    const script zero{ script::to_pay_witness_key_hash_pattern(null_short_hash) };
+    BOOST_REQUIRE(!is_standard(segwit_flags, spend(zero, {}, { key, key })));
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect_standard__bip143_native_p2wpkh__success)
+{
+    const auto decoded_tx = base16_chunk("01000000000102fff7f7881a8099afa6940d42d1e7f6362bec38171ea3edf433541db4e4ad969f00000000494830450221008b9d1dc26ba6a9cb62127b02742fa9d754cd3bebf337f7a55d114c8e5cdd30be022040529b194ba3f9281a99f2b1c0a19c0489bc22ede944ccf4ecbab4cc618ef3ed01eeffffffef51e1b804cc89d182d279655c3aa89e815b1b309fe287d9b2b55d57b90ec68a0100000000ffffffff02202cb206000000001976a9148280b37df378db99f66f85c95a783a76ac7a6d5988ac9093510d000000001976a9143bde42dbee7e4dbe6a21b2d50ce2f0167faa815988ac000247304402203609e17b84f6a7d30c80bfa610b5b4542f32a8a0d5447a12fb1366d7f01cc44a0220573a954c4518331561406f90300e8f3358f51928d43c212a8caed02de67eebee0121025476c2e83188368da1ff3e292e7acafcdb3566bb0ad253f62fc70f07aeee635711000000");
+    const transaction tx(decoded_tx, true);
+    BOOST_REQUIRE(tx.is_valid());
+
+    const auto& input = *(*tx.inputs_ptr())[1];
+    input.prevout = to_shared(output{ 600000000u, { base16_chunk("00141d0f172a0ecb48aee1be1f2687d2963ae33f71a1"), false } });
+
+    BOOST_REQUIRE_EQUAL(connect(segwit_flags, tx, 1), error::script_success);
+    BOOST_REQUIRE_EQUAL(connect(flags::bip141_rule, tx, 1), error::stack_false);
+}
+
+// p2tr (key path)
+
+BOOST_AUTO_TEST_CASE(interpreter__connect_standard__taproot_key_signed__success)
+{
+    const auto point = public_key(secret);
+    const script prevout{ script::to_pay_witness_pattern(1, x_only(point)) };
+    const auto sig = sign(secret, prevout, {}, {}, taproot_flags);
+    const auto tx = spend(prevout, {}, { sig });
+    BOOST_REQUIRE_EQUAL(connect(taproot_flags, tx), error::script_success);
+
+    const auto wrong = sign(other_secret, prevout, {}, {}, taproot_flags);
+    BOOST_REQUIRE(connect(taproot_flags, spend(prevout, {}, { wrong })) !=
+        error::script_success);
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect_standard__taproot_key_invalid_signature__generic_equivalent)
+{
+    const auto key = base16_chunk(
+        "79be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798");
+    const script prevout{ script::to_pay_witness_pattern(1, key) };
+
+    const data_chunk sig(schnorr::signature_size, 0x42);
+    const auto tx = spend(prevout, {}, { sig });
+    BOOST_REQUIRE(connect(taproot_flags, tx) != error::script_success);
+    BOOST_REQUIRE_EQUAL(connect(flags::all_rules, tx), connect(taproot_flags, tx));
+
+    const auto empty = spend(prevout, {}, { data_chunk{} });
+    BOOST_REQUIRE(connect(taproot_flags, empty) != error::script_success);
+
+    const data_chunk big(add1(max_push_data_size), 0x42);
+    const auto oversized = spend(prevout, {}, { big });
+    BOOST_REQUIRE_EQUAL(connect(taproot_flags, oversized), error::invalid_witness_stack);
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect_standard__taproot_nonstandard__not_handled)
+{
+    const auto key = base16_chunk(
+        "79be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798");
+    const script prevout{ script::to_pay_witness_pattern(1, key) };
+    const data_chunk sig(schnorr::signature_size, 0x42);
+
+    // Taproot rules inactive.
+    BOOST_REQUIRE(!is_standard(segwit_flags, spend(prevout, {}, { sig })));
+
+    // Annex or script path.
+    BOOST_REQUIRE(!is_standard(taproot_flags, spend(prevout, {}, { sig, { 0x50 } })));
+
+    // Dirty input script.
+    BOOST_REQUIRE(!is_standard(taproot_flags, spend(prevout, script{ "0" }, { sig })));
+}
+
+// multisig
+
+data_chunk uncompressed_key(const ec_secret& key, bool hybrid=false) NOEXCEPT
+{
+    ec_uncompressed point{};
+    BOOST_REQUIRE(secret_to_public(point, key));
+    if (hybrid)
+        point.front() = bit_or<uint8_t>(0x06, bit_and<uint8_t>(point.back(), 1));
+
+    return to_chunk(point);
+}
+
+// Replace s with n - s in a DER endorsement (high-s is not normalized).
+endorsement high_s(const endorsement& low) NOEXCEPT
+{
+    const auto r_size = low.at(3);
+    const auto s_size = low.at(5u + r_size);
+    const auto s_begin = std::next(low.begin(), 6u + r_size);
+    const data_chunk r(std::next(low.begin(), 4), std::next(low.begin(), 4u + r_size));
+
+    ec_secret s{};
+    std::copy_backward(s_begin, std::next(s_begin, s_size), s.end());
+    BOOST_REQUIRE(ec_negate(s));
+
+    data_chunk high(std::find_if(s.begin(), s.end(), [](auto byte) { return !is_zero(byte); }), s.end());
+    if (get_left(high.front()))
+        high.insert(high.begin(), 0x00);
+
+    endorsement out{ 0x30, narrow_cast<uint8_t>(4u + r.size() + high.size()), 0x02, r_size };
+    out.insert(out.end(), r.begin(), r.end());
+    out.push_back(0x02);
+    out.push_back(narrow_cast<uint8_t>(high.size()));
+    out.insert(out.end(), high.begin(), high.end());
+    out.push_back(low.back());
+    return out;
+}
+
+transaction multisig(uint8_t signatures, const data_stack& points,
+    const std_vector<ec_secret>& signers, bool high=false) NOEXCEPT
+{
+    // Not a multisig pattern, as points may be hybrid or invalid.
+    std::string output{ std::to_string(signatures) };
+    for (const auto& point: points)
+        output += " [" + encode_base16(point) + "]";
+
+    const script prevout{ output + " " + std::to_string(points.size()) +
+        " checkmultisig" };
+
+    std::string input{ "0" };
+    for (const auto& signer: signers)
+    {
+        const auto low = sign(signer, prevout, script_version::unversioned,
+            flags::no_rules);
+        input += " [" + encode_base16(high ? high_s(low) : low) + "]";
+    }
+
+    return spend(prevout, script{ input }, {});
+}
+
+// Ordered verification of each signature against remaining keys (reference).
+code ordered_multisig(const transaction& tx, const data_stack& points,
+    size_t signatures) NOEXCEPT
+{
+    const auto& input = *tx.inputs_ptr()->front();
+    const auto& prevout = input.prevout->script();
+    const auto& ops = input.script().ops();
+    BOOST_REQUIRE_EQUAL(ops.size(), add1(signatures));
+
+    auto it = std::next(ops.begin());
+    for (const auto& point: points)
+    {
+        if (it == ops.end())
+            break;
+
+        ec_signature signature{};
+        const auto& endorsement = it->data();
+        const data_chunk der(endorsement.begin(), std::prev(endorsement.end()));
+        BOOST_REQUIRE(ecdsa::parse_signature(signature, der, false));
+
+        if (tx.check_signature(signature, point, prevout, 0, value,
+            endorsement.back(), script_version::unversioned, flags::no_rules))
+            ++it;
+    }
+
+    return it == ops.end() ? error::script_success : error::stack_false;
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect__multisig_one_of_three_last__success)
+{
+    const data_stack points
+    {
+        to_chunk(public_key(other_secret)),
+        to_chunk(public_key(third_secret)),
+        to_chunk(public_key(secret))
+    };
+
+    const auto tx = multisig(1, points, { secret });
+    BOOST_REQUIRE_EQUAL(connect_generic(rules::pre_segwit, tx), error::script_success);
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect__multisig_one_of_three_unlisted__stack_false)
+{
+    const data_stack points
+    {
+        to_chunk(public_key(other_secret)),
+        to_chunk(public_key(third_secret)),
+        uncompressed_key(other_secret)
+    };
+
+    const auto tx = multisig(1, points, { secret });
+    BOOST_REQUIRE_EQUAL(connect_generic(rules::pre_segwit, tx), error::stack_false);
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect__multisig_one_of_three_uncompressed__success)
+{
+    const data_stack points
+    {
+        to_chunk(public_key(other_secret)),
+        to_chunk(public_key(third_secret)),
+        uncompressed_key(secret)
+    };
+
+    const auto tx = multisig(1, points, { secret });
+    BOOST_REQUIRE_EQUAL(connect_generic(rules::pre_segwit, tx), error::script_success);
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect__multisig_one_of_three_hybrid__verified)
+{
+    const data_stack points
+    {
+        to_chunk(public_key(other_secret)),
+        to_chunk(public_key(third_secret)),
+        uncompressed_key(secret, true)
+    };
+
+    const auto tx = multisig(1, points, { secret });
+    BOOST_REQUIRE_EQUAL(connect_generic(rules::pre_segwit, tx), error::script_success);
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect__multisig_two_of_five_order__ordered_result)
+{
+    const data_stack points
+    {
+        to_chunk(public_key(third_secret)),
+        to_chunk(public_key(secret)),
+        uncompressed_key(third_secret),
+        to_chunk(public_key(other_secret)),
+        uncompressed_key(secret)
+    };
+
+    // Signatures must match keys in order, each key matched at most once.
+    const auto ordered = multisig(2, points, { secret, other_secret });
+    const auto misordered = multisig(2, points, { other_secret, secret });
+    const auto repeated = multisig(2, points, { other_secret, other_secret });
+    BOOST_REQUIRE_EQUAL(connect_generic(rules::pre_segwit, ordered), error::script_success);
+    BOOST_REQUIRE_EQUAL(connect_generic(rules::pre_segwit, misordered), error::stack_false);
+    BOOST_REQUIRE_EQUAL(connect_generic(rules::pre_segwit, repeated), error::stack_false);
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect__multisig_invalid_key__skipped)
+{
+    const data_stack points
+    {
+        data_chunk(ec_compressed_size, 0x02),
+        data_chunk{ 0x42 },
+        data_chunk{},
+        to_chunk(public_key(secret))
+    };
+
+    const auto tx = multisig(1, points, { secret });
+    BOOST_REQUIRE_EQUAL(connect_generic(rules::pre_segwit, tx), error::script_success);
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect__multisig_high_s__verified)
+{
+    const data_stack points
+    {
+        to_chunk(public_key(other_secret)),
+        to_chunk(public_key(third_secret)),
+        to_chunk(public_key(secret))
+    };
+
+    const auto tx = multisig(1, points, { secret }, true);
+    BOOST_REQUIRE_EQUAL(connect_generic(rules::pre_segwit, tx), error::script_success);
+}
+
+// Keys of every encoding, for matching against recovered points.
+data_stack differential_points() NOEXCEPT
+{
+    data_stack out{};
+    for (const auto& key: { secret, other_secret, third_secret })
+    {
+        const auto compressed = to_chunk(public_key(key));
+        auto negated = compressed;
+        negated.front() = bit_xor<uint8_t>(negated.front(), 1);
+        auto hybrid_wrong_parity = uncompressed_key(key, true);
+        hybrid_wrong_parity.front() = bit_xor<uint8_t>(hybrid_wrong_parity.front(), 1);
+        auto padded = compressed;
+        padded.resize(ec_uncompressed_size, 0x00);
+
+        out.push_back(compressed);
+        out.push_back(uncompressed_key(key));
+        out.push_back(uncompressed_key(key, true));
+        out.push_back(hybrid_wrong_parity);
+        out.push_back(negated);
+        out.push_back(padded);
+    }
+
+    out.push_back(data_chunk(ec_compressed_size, 0x02));
+    out.push_back(data_chunk(ec_uncompressed_size, 0x04));
+    out.push_back(data_chunk{ 0x42 });
+    out.push_back(data_chunk{});
+    return out;
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__match_ecdsa__differential__same_as_verify)
+{
+    const auto hash = bitcoin_hash(to_chunk("multisig differential"));
+    const auto points = differential_points();
+    size_t verified{};
+
+    for (const auto& key: { secret, other_secret, third_secret })
+    {
+        ec_signature low{};
+        BOOST_REQUIRE(ecdsa::sign(low, key, hash));
+
+        der_signature der{};
+        BOOST_REQUIRE(ecdsa::encode_signature(der, low));
+        endorsement high_der{ high_s(splice(der, data_chunk{ 0x01 })) };
+        high_der.pop_back();
+
+        ec_signature high{};
+        BOOST_REQUIRE(ecdsa::parse_signature(high, high_der, false));
+        BOOST_REQUIRE(high != low);
+
+        for (const auto& signature: { low, high, ec_signature{} })
+        {
+            uncompressed_list candidates{};
+            const auto recovered = accessor::recover_ecdsa(candidates, hash,
+                signature);
+
+            for (const auto& point: points)
+            {
+                const auto expected = accessor::verify_ecdsa(point, hash, signature);
+                const auto matched = recovered ?
+                    accessor::match_ecdsa(point, candidates, hash, signature) :
+                    accessor::verify_ecdsa(point, hash, signature);
+
+                BOOST_REQUIRE_MESSAGE(matched == expected, encode_base16(point));
+                verified += to_int(expected);
+            }
+        }
+    }
+
+    // Each signer verifies against its compressed, uncompressed and hybrid
+    // keys, for both low-s and high-s signatures.
+    BOOST_REQUIRE_EQUAL(verified, 3u * 2u * 3u);
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect__multisig_differential__ordered_result)
+{
+    const auto all = differential_points();
+    const std_vector<ec_secret> signers{ secret, other_secret, third_secret };
+
+    // Windows of keys, with each ordered pair (and single) of signers, using
+    // low-s and high-s signatures. Recovery applies where keys exceed twice
+    // the signatures, and its result must equal ordered verification.
+    for (size_t start = 0; start < all.size(); start += 2u)
+    {
+        const auto count = std::min<size_t>(7, all.size() - start);
+        const data_stack points(std::next(all.begin(), start),
+            std::next(all.begin(), start + count));
+
+        for (const auto& first: signers)
+        {
+            for (const auto& second: signers)
+            {
+                for (const auto high: { false, true })
+                {
+                    const auto one = multisig(1, points, { first }, high);
+                    BOOST_REQUIRE_EQUAL(connect_generic(rules::pre_segwit, one),
+                        ordered_multisig(one, points, 1));
+
+                    const auto two = multisig(2, points, { first, second }, high);
+                    BOOST_REQUIRE_EQUAL(connect_generic(rules::pre_segwit, two),
+                        ordered_multisig(two, points, 2));
+                }
+            }
+        }
+    }
+}
+
+// rules
+
+BOOST_AUTO_TEST_CASE(interpreter__rules__is_epoch__non_script_flags_ignored)
+{
+    constexpr auto other = flags::retarget | flags::bip30_rule |
+        flags::bip34_rule | flags::bip68_rule | flags::bip113_rule;
+
+    static_assert(rules::is_epoch(rules::taproot | other, rules::taproot));
+    static_assert(rules::is_epoch(rules::segwit | other, rules::segwit));
+    static_assert(rules::is_epoch(rules::pre_segwit | other, rules::pre_segwit));
+    static_assert(!rules::is_epoch(rules::segwit, rules::taproot));
+    static_assert(!rules::is_epoch(rules::taproot | flags::nops_rule, rules::taproot));
+    static_assert(!rules::is_epoch(flags::all_rules, rules::taproot));
+    BOOST_REQUIRE(rules::is_epoch(flags::no_rules, flags::no_rules));
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect__taproot_rules_witness__dynamic_equivalent)
+{
+    using specialized = interpreter<contiguous_stack, rules::taproot>;
+    const auto key = base16_chunk(
+        "79be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798");
+    const script prevout{ script::to_pay_witness_pattern(1, key) };
+    const data_chunk sig(schnorr::signature_size, 0x42);
+    const auto point = public_key(secret);
+    const script witnessed{ script::to_pay_key_hash_pattern(
+        bitcoin_short_hash(point)) };
+
+    const auto taproot = spend(prevout, {}, { sig });
+    const auto annexed = spend(prevout, {}, { sig, { 0x50 } });
+    const auto segwit = spend(witnessed, {}, { sig, to_chunk(point) });
+    BOOST_REQUIRE_EQUAL(specialized::connect({ rules::taproot }, taproot, 0),
+        interpreter<contiguous_stack>::connect({ rules::taproot }, taproot, 0));
+    BOOST_REQUIRE_EQUAL(specialized::connect({ rules::taproot }, annexed, 0),
+        interpreter<contiguous_stack>::connect({ rules::taproot }, annexed, 0));
+    BOOST_REQUIRE_EQUAL(specialized::connect({ rules::taproot }, segwit, 0),
+        interpreter<contiguous_stack>::connect({ rules::taproot }, segwit, 0));
 }
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,91 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_TEST_MACHINE_MACHINE_HPP
+#define LIBBITCOIN_SYSTEM_TEST_MACHINE_MACHINE_HPP
+
+#include "../test.hpp"
+
+// Signing fixtures for single input spends.
+
+const auto secret = base16_hash(
+    "ce8f4b713ffdd2658900845251890f30371856be201cd1f5b3d970f793634333");
+const auto other_secret = base16_hash(
+    "b3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee097");
+const auto third_secret = base16_hash(
+    "8010b1bb119ad37d4b65a1022a314897b1b3614b345974332cb1b9582cf03536");
+constexpr auto value = 42'000u;
+
+// Single input spend of the given prevout script.
+inline chain::transaction spend(const chain::script& prevout,
+    const chain::script& input_script, const data_stack& stack,
+    uint64_t amount=value) NOEXCEPT
+{
+    using namespace chain;
+    const transaction tx
+    {
+        1,
+        inputs{ { point{ null_hash, 0 }, input_script, witness{ stack }, 0 } },
+        outputs{ { 0, script{} } },
+        0
+    };
+
+    tx.inputs_ptr()->front()->prevout = to_shared(output{ amount, prevout });
+    return tx;
+}
+
+inline ec_compressed public_key(const ec_secret& key) NOEXCEPT
+{
+    ec_compressed point{};
+    BOOST_REQUIRE(secret_to_public(point, key));
+    return point;
+}
+
+inline data_chunk x_only(const ec_compressed& point) NOEXCEPT
+{
+    return { std::next(point.begin()), point.end() };
+}
+
+// ECDSA endorsement (hash_all) of a spend of subscript.
+inline endorsement sign(const ec_secret& key, const chain::script& subscript,
+    chain::script_version version, uint32_t active_flags) NOEXCEPT
+{
+    endorsement out{};
+    const auto tx = spend(subscript, {}, {});
+    BOOST_REQUIRE(tx.create_endorsement(out, key, subscript, 0, value,
+        chain::coverage::hash_all, version, active_flags));
+    return out;
+}
+
+// Schnorr signature (hash_default) of a taproot spend of prevout, key path
+// if tapleaf is null, otherwise script path of the leaf script.
+inline data_chunk sign(const ec_secret& key, const chain::script& prevout,
+    const chain::script& leaf, const hash_cptr& tapleaf,
+    uint32_t active_flags) NOEXCEPT
+{
+    hash_digest hash{};
+    ec_signature signature{};
+    const auto tx = spend(prevout, {}, {});
+    BOOST_REQUIRE(tx.signature_hash(hash, tx.inputs_ptr()->begin(), leaf,
+        value, tapleaf, chain::script_version::taproot,
+        chain::coverage::hash_default, active_flags));
+    BOOST_REQUIRE(schnorr::sign(signature, key, hash, null_hash));
+    return to_chunk(signature);
+}
+
+#endif
@@ -0,0 +1,278 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+#include "machine.hpp"
+
+#if defined(HAVE_PERFORMANCE_TESTS)
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Allocation counting (replaces global allocation for the test process).
+// ----------------------------------------------------------------------------
+
+static std::atomic<size_t> allocations{};
+
+void* operator new(size_t size)
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (const auto pointer = std::malloc(size == 0u ? 1u : size))
+        return pointer;
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept
+{
+    std::free(pointer);
+}
+
+BOOST_AUTO_TEST_SUITE(performance_machine_tests)
+
+using namespace system::chain;
+using namespace system::machine;
+
+// Corpus.
+// ----------------------------------------------------------------------------
+// Signatures are valid, so each case is measured on its expected result.
+// Adversarial cases are limited by standard script limits.
+
+struct corpus_case
+{
+    std::string name;
+    transaction tx;
+    uint32_t flags;
+    size_t signatures;
+    code expected;
+};
+
+typedef std_vector<corpus_case> corpus;
+
+constexpr auto rounds = 1'000u;
+constexpr auto active_flags = rules::taproot;
+
+class taproot_accessor
+  : public taproot
+{
+public:
+    using taproot::tweak_hash;
+};
+
+static std::string push(const data_slice& data) NOEXCEPT
+{
+    return "[" + encode_base16(data) + "]";
+}
+
+static std::string repeat(const std::string& text, size_t count) NOEXCEPT
+{
+    std::string out{};
+    for (size_t index = 0; index < count; ++index)
+        out += text;
+
+    return out;
+}
+
+static corpus create_corpus() NOEXCEPT
+{
+    using namespace system;
+    constexpr auto unversioned = script_version::unversioned;
+    constexpr auto segwit = script_version::segwit;
+    const auto success = error::script_success;
+    const auto point1 = public_key(secret);
+    const auto point2 = public_key(other_secret);
+    const auto point3 = public_key(third_secret);
+    corpus out{};
+
+    // p2pkh.
+    const script key_hash{ script::to_pay_key_hash_pattern(
+        bitcoin_short_hash(point1)) };
+    const auto key_hash_sig = sign(secret, key_hash, unversioned,
+        active_flags);
+    out.push_back({ "p2pkh", spend(key_hash, script{ push(key_hash_sig) +
+        " " + push(point1) }, {}), active_flags, 1, success });
+
+    // p2sh 2-of-3 multisig.
+    const script multisig{ script::to_pay_multisig_pattern(2,
+        compressed_list{ point1, point2, point3 }) };
+    const auto redeem = multisig.to_data(false);
+    const script script_hash{ script::to_pay_script_hash_pattern(
+        bitcoin_short_hash(redeem)) };
+    const auto multisig_sig1 = sign(secret, multisig, unversioned,
+        active_flags);
+    const auto multisig_sig2 = sign(other_secret, multisig, unversioned,
+        active_flags);
+    out.push_back({ "p2sh_multisig", spend(script_hash, script{ "0 " +
+        push(multisig_sig1) + " " + push(multisig_sig2) + " " +
+        push(redeem) }, {}), active_flags, 2, success });
+
+    // p2wpkh.
+    const script witness_key_hash{ script::to_pay_witness_key_hash_pattern(
+        bitcoin_short_hash(point1)) };
+    const auto witness_key_hash_sig = sign(secret, key_hash, segwit,
+        active_flags);
+    out.push_back({ "p2wpkh", spend(witness_key_hash, {},
+        { witness_key_hash_sig, to_chunk(point1) }), active_flags, 1,
+        success });
+
+    // p2wsh 2-of-3 multisig.
+    const script witness_script_hash{
+        script::to_pay_witness_script_hash_pattern(sha256_hash(redeem)) };
+    const auto witness_sig1 = sign(secret, multisig, segwit, active_flags);
+    const auto witness_sig2 = sign(other_secret, multisig, segwit,
+        active_flags);
+    out.push_back({ "p2wsh_multisig", spend(witness_script_hash, {},
+        { {}, witness_sig1, witness_sig2, redeem }), active_flags, 2,
+        success });
+
+    // p2tr key path (output key is point1, untweaked).
+    const script taproot_key{ script::to_pay_witness_pattern(1,
+        x_only(point1)) };
+    const auto taproot_key_sig = sign(secret, taproot_key, {}, {},
+        active_flags);
+    out.push_back({ "p2tr_key_path", spend(taproot_key, {},
+        { taproot_key_sig }), active_flags, 1, success });
+
+    // p2tr script path (single leaf, internal key is even lift of point2).
+    const script leaf{ push(x_only(point1)) + " checksig" };
+    const auto internal = x_only(point2);
+    const auto& internal_key = unsafe_array_cast<uint8_t, ec_xonly_size>(
+        internal.data());
+    const auto leaf_hash = taproot::leaf_hash(0xc0, leaf);
+    auto tweaked = point2;
+    tweaked.front() = ec_even_sign;
+    BOOST_REQUIRE(ec_add(tweaked, taproot_accessor::tweak_hash(internal_key,
+        leaf_hash)));
+    data_chunk control{ bit_or<uint8_t>(0xc0, to_int(
+        !is_even_key(tweaked))) };
+    control.insert(control.end(), internal.begin(), internal.end());
+    const script taproot_script{ script::to_pay_witness_pattern(1,
+        x_only(tweaked)) };
+    const auto taproot_script_sig = sign(secret, taproot_script, leaf,
+        to_shared(leaf_hash), active_flags);
+    out.push_back({ "p2tr_script_path", spend(taproot_script, {},
+        { taproot_script_sig, leaf.to_data(false), control }), active_flags,
+        1, success });
+
+    // Bare 1-of-15 multisig, signed by the last key.
+    compressed_list points(15, point2);
+    points.back() = point1;
+    const script wide{ script::to_pay_multisig_pattern(1, points) };
+    const auto wide_sig = sign(secret, wide, unversioned, active_flags);
+    out.push_back({ "adversarial_wide_multisig", spend(wide,
+        script{ "0 " + push(wide_sig) }, {}), active_flags, 1, success });
+
+    // Legacy signature operations, each with its own signature hash.
+    const script sigops{ repeat("2dup checksig drop ", 60) + "checksig" };
+    const auto sigops_sig = sign(secret, sigops, unversioned, active_flags);
+    out.push_back({ "adversarial_sigops", spend(sigops,
+        script{ push(sigops_sig) + " " + push(point1) }, {}), active_flags,
+        61, success });
+
+    // Endorsement pushes and code separators, stripped for each signature.
+    // Each signature fails (dropped), as it does not commit to the stripped
+    // subscript, so the script succeeds on its final push.
+    const auto strip_sig = sign(secret, key_hash, unversioned, active_flags);
+    const script strip{ repeat(push(strip_sig) +
+        " drop codeseparator 2dup checksig drop ", 40) + "2drop 1" };
+    out.push_back({ "adversarial_find_and_delete", spend(strip,
+        script{ push(strip_sig) + " " + push(point1) }, {}), active_flags,
+        40, success });
+
+    // Maximal element hashing.
+    const data_chunk element(max_push_data_size, 0x42);
+    const script hashing{ repeat("dup sha256 drop ", 66) + "drop 1" };
+    out.push_back({ "adversarial_hashing", spend(hashing,
+        script{ push(element) }, {}), active_flags, 0, success });
+
+    return out;
+}
+
+// Runner.
+// ----------------------------------------------------------------------------
+
+template <typename Stack, uint32_t Rules = rules::dynamic>
+static bool test_connect(std::ostream& out, const corpus_case& test,
+    const std::string& stack) NOEXCEPT
+{
+    using namespace std::chrono;
+    using evaluator = interpreter<Stack, Rules>;
+    const context ctx{ test.flags };
+    uint64_t time{};
+    size_t allocated{};
+    code ec{};
+
+    for (size_t round = 0; round < rounds; ++round)
+    {
+        const auto count = allocations.load(std::memory_order_relaxed);
+        const auto start = steady_clock::now();
+        ec = evaluator::connect(ctx, test.tx, 0);
+        time += duration_cast<nanoseconds>(steady_clock::now() - start)
+            .count();
+        allocated += allocations.load(std::memory_order_relaxed) - count;
+    }
+
+    const auto seconds = (1.0 * time) / std::nano::den;
+    const auto signatures = test.signatures * rounds;
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    out << "\n"
+        << "test____________: " << TEST_NAME << "\n"
+        << "case____________: " << test.name << "\n"
+        << "stack___________: " << stack << "\n"
+        << "specialized_____: " << serialize(Rules != rules::dynamic) << "\n"
+        << "result__________: " << ec.message() << "\n"
+        << "expected________: " << test.expected.message() << "\n"
+        << "ns_per_input____: " << serialize(time / rounds) << "\n"
+        << "allocs_per_input: " << serialize(allocated / rounds) << "\n"
+        << "sigs_per_second_: " << serialize(signatures / seconds) << "\n";
+    BC_POP_WARNING()
+
+    // Dumping output also precludes compiler removal.
+    return ec == test.expected;
+}
+
+static bool test_corpus(std::ostream& out, const corpus& cases) NOEXCEPT
+{
+    auto complete = true;
+    for (const auto& test: cases)
+    {
+        complete &= test_connect<linked_stack>(out, test, "linked");
+        complete &= test_connect<contiguous_stack>(out, test, "contiguous");
+        complete &= test_connect<inline_stack>(out, test, "inline");
+        complete &= test_connect<inline_stack, rules::taproot>(out, test,
+            "inline");
+    }
+
+    return complete;
+}
+
+BOOST_AUTO_TEST_CASE(performance__interpreter__connect_corpus)
+{
+    BOOST_CHECK(test_corpus(std::cout, create_corpus()));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
@@ -0,0 +1,248 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(profiler_tests)
+
+using namespace system::chain;
+using namespace system::machine;
+
+#if defined(HAVE_PROFILE)
+
+BOOST_AUTO_TEST_CASE(profiler__snapshot__default__zeroed)
+{
+    const profiler instance{};
+    const auto report = instance.snapshot();
+    BOOST_REQUIRE_EQUAL(report.counts[static_cast<uint8_t>(opcode::checksig)], 0u);
+    BOOST_REQUIRE_EQUAL(report.max_depth, 0u);
+    BOOST_REQUIRE_EQUAL(report.sighashes, 0u);
+    BOOST_REQUIRE_EQUAL(report.verifies, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(profiler__op__repeated__accumulated)
+{
+    profiler instance{};
+    instance.op(opcode::dup, 10);
+    instance.op(opcode::dup, 5);
+    instance.op(opcode::checksig, 100);
+    const auto report = instance.snapshot();
+    BOOST_REQUIRE_EQUAL(report.counts[static_cast<uint8_t>(opcode::dup)], 2u);
+    BOOST_REQUIRE_EQUAL(report.cycles[static_cast<uint8_t>(opcode::dup)], 15u);
+    BOOST_REQUIRE_EQUAL(report.counts[static_cast<uint8_t>(opcode::checksig)], 1u);
+    BOOST_REQUIRE_EQUAL(report.cycles[static_cast<uint8_t>(opcode::checksig)], 100u);
+}
+
+BOOST_AUTO_TEST_CASE(profiler__depth__descending__high_water)
+{
+    profiler instance{};
+    instance.depth(3);
+    instance.depth(7);
+    instance.depth(2);
+    BOOST_REQUIRE_EQUAL(instance.snapshot().max_depth, 7u);
+}
+
+BOOST_AUTO_TEST_CASE(profiler__record__events__accumulated)
+{
+    profiler instance{};
+    instance.record(profiler::event::sighash, 3);
+    instance.record(profiler::event::sighash, 4);
+    instance.record(profiler::event::verify, 9);
+    const auto report = instance.snapshot();
+    BOOST_REQUIRE_EQUAL(report.sighashes, 2u);
+    BOOST_REQUIRE_EQUAL(report.sighash_cycles, 7u);
+    BOOST_REQUIRE_EQUAL(report.verifies, 1u);
+    BOOST_REQUIRE_EQUAL(report.verify_cycles, 9u);
+}
+
+BOOST_AUTO_TEST_CASE(profiler__reset__recorded__zeroed)
+{
+    profiler instance{};
+    instance.op(opcode::dup, 10);
+    instance.depth(3);
+    instance.record(profiler::event::verify, 9);
+    instance.reset();
+    const auto report = instance.snapshot();
+    BOOST_REQUIRE_EQUAL(report.counts[static_cast<uint8_t>(opcode::dup)], 0u);
+    BOOST_REQUIRE_EQUAL(report.max_depth, 0u);
+    BOOST_REQUIRE_EQUAL(report.verifies, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(profiler__trace__tracer__invoked)
+{
+    size_t calls{};
+    size_t last{};
+    profiler instance{ [&](const operation& op, size_t depth) NOEXCEPT
+    {
+        BOOST_REQUIRE(op.code() == opcode::dup);
+        last = depth;
+        ++calls;
+    } };
+
+    instance.trace(operation{ opcode::dup }, 42);
+    BOOST_REQUIRE_EQUAL(calls, 1u);
+    BOOST_REQUIRE_EQUAL(last, 42u);
+}
+
+BOOST_AUTO_TEST_CASE(profiler__trace__no_tracer__no_effect)
+{
+    const profiler instance{};
+    instance.trace(operation{ opcode::dup }, 42);
+}
+
+BOOST_AUTO_TEST_CASE(profiler__scope__nested__restored)
+{
+    profiler outer{};
+    profiler inner{};
+    BOOST_REQUIRE(is_null(profiler::current()));
+    {
+        const profiler::scope first{ &outer };
+        BOOST_REQUIRE_EQUAL(profiler::current(), &outer);
+        {
+            const profiler::scope second{ &inner };
+            BOOST_REQUIRE_EQUAL(profiler::current(), &inner);
+        }
+
+        BOOST_REQUIRE_EQUAL(profiler::current(), &outer);
+    }
+
+    BOOST_REQUIRE(is_null(profiler::current()));
+}
+
+BOOST_AUTO_TEST_CASE(profiler__timer__scoped__recorded_to_current)
+{
+    profiler instance{};
+    {
+        const profiler::timer unscoped{ profiler::event::verify };
+    }
+
+    {
+        const profiler::scope scope{ &instance };
+        const profiler::timer timer{ profiler::event::sighash };
+    }
+
+    const auto report = instance.snapshot();
+    BOOST_REQUIRE_EQUAL(report.sighashes, 1u);
+    BOOST_REQUIRE_EQUAL(report.verifies, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(profiler__to_string__recorded__executed_rows)
+{
+    profiler instance{};
+    instance.op(opcode::dup, 10);
+    const auto text = instance.snapshot().to_string();
+    BOOST_REQUIRE(text.find("dup\t1\t10\n") != std::string::npos);
+    BOOST_REQUIRE(text.find("checksig") == std::string::npos);
+    BOOST_REQUIRE(text.find("max_depth\t0\n") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(profiler__input__standard__accumulated_and_reported)
+{
+    profiler instance{};
+    instance.input(profiler::standard::key_hash, 10);
+    instance.input(profiler::standard::key_hash, 5);
+    instance.input(profiler::standard::taproot_key, 7);
+    const auto report = instance.snapshot();
+    constexpr auto key_hash = static_cast<size_t>(profiler::standard::key_hash);
+    constexpr auto taproot_key = static_cast<size_t>(profiler::standard::taproot_key);
+    BOOST_REQUIRE_EQUAL(report.standard_counts[key_hash], 2u);
+    BOOST_REQUIRE_EQUAL(report.standard_cycles[key_hash], 15u);
+    BOOST_REQUIRE_EQUAL(report.standard_counts[taproot_key], 1u);
+
+    const auto text = report.to_string();
+    BOOST_REQUIRE(text.find("[key_hash]\t2\t15\n") != std::string::npos);
+    BOOST_REQUIRE(text.find("[witness_key_hash]") == std::string::npos);
+
+    instance.reset();
+    BOOST_REQUIRE_EQUAL(instance.snapshot().standard_counts[key_hash], 0u);
+}
+
+BOOST_AUTO_TEST_CASE(profiler__connect__context_profile__ops_recorded)
+{
+    const transaction tx
+    {
+        1,
+        inputs{ { point{ one_hash, 0 }, script{ "1 2" }, 0 } },
+        outputs{},
+        0
+    };
+
+    tx.inputs_ptr()->front()->prevout = to_shared(output{ 0, script{ "add 3 equal" } });
+
+    profiler instance{};
+    context ctx{ flags::no_rules };
+    ctx.profile = &instance;
+    BOOST_REQUIRE(!tx.connect(ctx));
+
+    const auto report = instance.snapshot();
+    BOOST_REQUIRE_EQUAL(report.counts[static_cast<uint8_t>(opcode::add)], 1u);
+    BOOST_REQUIRE_EQUAL(report.counts[static_cast<uint8_t>(opcode::equal)], 1u);
+    BOOST_REQUIRE_EQUAL(report.max_depth, 2u);
+}
+
+BOOST_AUTO_TEST_CASE(profiler__connect__standard_key_hash__recorded_by_template)
+{
+    const ec_secret secret = base16_hash(
+        "ce8f4b713ffdd2658900845251890f30371856be201cd1f5b3d970f793634333");
+
+    ec_compressed key{};
+    BOOST_REQUIRE(secret_to_public(key, secret));
+    const script prevout{ script::to_pay_key_hash_pattern(
+        bitcoin_short_hash(key)) };
+
+    const transaction tx
+    {
+        1,
+        inputs{ { point{ one_hash, 0 }, script{}, 0 } },
+        outputs{},
+        0
+    };
+
+    tx.inputs_ptr()->front()->prevout = to_shared(output{ 0, prevout });
+
+    endorsement sig{};
+    BOOST_REQUIRE(tx.create_endorsement(sig, secret, prevout, 0, 0,
+        coverage::hash_all, script_version::unversioned, flags::no_rules));
+
+    const transaction spend
+    {
+        1,
+        inputs{ { point{ one_hash, 0 }, script{ { operation{ sig, true },
+            operation{ to_chunk(key), true } } }, 0 } },
+        outputs{},
+        0
+    };
+
+    spend.inputs_ptr()->front()->prevout = to_shared(output{ 0, prevout });
+
+    profiler instance{};
+    context ctx{ flags::no_rules };
+    ctx.profile = &instance;
+    BOOST_REQUIRE(!spend.connect(ctx));
+
+    const auto report = instance.snapshot();
+    constexpr auto key_hash = static_cast<size_t>(profiler::standard::key_hash);
+    BOOST_REQUIRE_EQUAL(report.standard_counts[key_hash], 1u);
+    BOOST_REQUIRE_EQUAL(report.counts[static_cast<uint8_t>(opcode::checksig)], 0u);
+    BOOST_REQUIRE_EQUAL(report.sighashes, 1u);
+    BOOST_REQUIRE_EQUAL(report.verifies, 1u);
+}
+
+#endif // HAVE_PROFILE
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -20,9 +20,97 @@
 
 BOOST_AUTO_TEST_SUITE(program_tests)
 
-BOOST_AUTO_TEST_CASE(program_test)
+using namespace system::chain;
+using namespace system::machine;
+
+class accessor
+  : public program<contiguous_stack>
+{
+public:
+    accessor(const transaction& tx) NOEXCEPT
+      : program(tx, tx.inputs_ptr()->begin(), flags::no_rules)
+    {
+    }
+
+    script::cptr subscript(const data_chunk& endorsement) NOEXCEPT
+    {
+        return program::subscript(chunk_xptr{ endorsement });
+    }
+
+    script::cptr subscript(const data_stack& endorsements) NOEXCEPT
+    {
+        chunk_xptrs pointers{};
+        for (const auto& endorsement: endorsements)
+            pointers.emplace_back(endorsement);
+
+        return program::subscript(pointers);
+    }
+};
+
+transaction spend(const script& input_script) NOEXCEPT
+{
+    return { 1, inputs{ { point{}, input_script, 0 } }, outputs{}, 0 };
+}
+
+const data_chunk endorsement1 = base16_chunk("3006020101020101");
+const data_chunk endorsement2 = base16_chunk("3006020102020102");
+
+BOOST_AUTO_TEST_CASE(program__subscript__no_strip_ops__unchanged)
+{
+    const auto tx = spend(script{ "dup [3006020101020102] 42 checksig" });
+    const auto& original = tx.inputs_ptr()->front()->script_ptr();
+    accessor instance{ tx };
+    BOOST_REQUIRE_EQUAL(instance.subscript(endorsement1), original);
+    BOOST_REQUIRE_EQUAL(instance.subscript({ endorsement1, endorsement2 }),
+        original);
+}
+
+BOOST_AUTO_TEST_CASE(program__subscript__endorsement__stripped)
+{
+    const auto tx = spend(script{ "[3006020101020101] dup checksig" });
+    accessor instance{ tx };
+    const auto stripped = instance.subscript(endorsement1);
+    BOOST_REQUIRE(*stripped == script{ "dup checksig" });
+}
+
+BOOST_AUTO_TEST_CASE(program__subscript__codeseparator__stripped)
+{
+    const auto tx = spend(script{ "dup codeseparator checksig" });
+    accessor instance{ tx };
+    BOOST_REQUIRE(*instance.subscript(endorsement1) == script{ "dup checksig" });
+}
+
+BOOST_AUTO_TEST_CASE(program__subscript__endorsements__all_stripped)
+{
+    const auto tx = spend(script
+    {
+        "[3006020101020101] [3006020102020102] 2 checkmultisig"
+    });
+
+    accessor instance{ tx };
+    BOOST_REQUIRE(*instance.subscript({ endorsement1, endorsement2 }) ==
+        script{ "2 checkmultisig" });
+}
+
+BOOST_AUTO_TEST_CASE(program__subscript__repeated__cached)
+{
+    const auto tx = spend(script{ "[3006020101020101] [3006020102020102]" });
+    accessor instance{ tx };
+    const auto first = instance.subscript(endorsement1);
+    BOOST_REQUIRE_EQUAL(instance.subscript(endorsement1), first);
+    BOOST_REQUIRE(*first == script{ "[3006020102020102]" });
+
+    const auto second = instance.subscript(endorsement2);
+    BOOST_REQUIRE(second != first);
+    BOOST_REQUIRE(*second == script{ "[3006020101020101]" });
+    BOOST_REQUIRE(*instance.subscript(endorsement1) == *first);
+}
+
+BOOST_AUTO_TEST_CASE(program__subscript__empty_endorsement__zero_pushes_stripped)
 {
-    BOOST_REQUIRE(true);
+    const auto tx = spend(script{ "0 1 0" });
+    accessor instance{ tx };
+    BOOST_REQUIRE(*instance.subscript(data_chunk{}) == script{ "1" });
 }
 
 BOOST_AUTO_TEST_SUITE_END()
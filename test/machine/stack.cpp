@@ -52,4 +52,29 @@ BOOST_AUTO_TEST_CASE(stack__pop__pushed_chunk__expected)
     BOOST_REQUIRE(stack.pop() == stack_variant{ ptr });
 }
 
+BOOST_AUTO_TEST_CASE(stack__erase__inline_stack_beyond_inline__expected)
+{
+    stack<inline_stack> stack{};
+    for (int64_t value = 0; value < 40; ++value)
+        stack.push(stack_variant{ value });
+
+    // Roll depth 39 (bottom element).
+    const auto rolled = stack.peek(39);
+    stack.erase(39);
+    stack.push(rolled);
+    BOOST_REQUIRE_EQUAL(stack.size(), 40u);
+    BOOST_REQUIRE(stack.top() == stack_variant{ int64_t{ 0 } });
+    BOOST_REQUIRE(stack.peek(39) == stack_variant{ int64_t{ 1 } });
+}
+
+BOOST_AUTO_TEST_CASE(stack__swap__inline_stack__expected)
+{
+    stack<inline_stack> stack{};
+    stack.push(true);
+    stack.push(42);
+    stack.swap(0, 1);
+    BOOST_REQUIRE(stack.pop() == stack_variant{ true });
+    BOOST_REQUIRE(stack.pop() == stack_variant{ 42 });
+}
+
 BOOST_AUTO_TEST_SUITE_END()
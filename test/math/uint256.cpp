@@ -0,0 +1,182 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+#include <random>
+
+BOOST_AUTO_TEST_SUITE(uint256_tests)
+
+using limbs = uint256::limbs_type;
+constexpr uint256 max_value{ limbs{ max_uint64, max_uint64, max_uint64, max_uint64 } };
+constexpr uint256 high_bit{ limbs{ 0, 0, 0, bit_hi<uint64_t> } };
+
+// construction/comparison
+static_assert(uint256{} == 0u);
+static_assert(uint256{ 42u }.low() == 42u);
+static_assert(uint256{ 42u } == uint256{ limbs{ 42, 0, 0, 0 } });
+static_assert(uint256{ 42u } < uint256{ 43u });
+static_assert(uint256{ limbs{ 0, 1, 0, 0 } } > uint256{ max_uint64 });
+static_assert(high_bit > uint256{ limbs{ max_uint64, max_uint64, max_uint64, 0 } });
+
+// bit_width
+static_assert(uint256{}.bit_width() == 0u);
+static_assert(uint256{ 1u }.bit_width() == 1u);
+static_assert(uint256{ limbs{ 0, 1, 0, 0 } }.bit_width() == 65u);
+static_assert(high_bit.bit_width() == 256u);
+
+// bitwise
+static_assert(~uint256{} == max_value);
+static_assert((max_value & uint256{ 0xffu }) == 0xffu);
+static_assert((uint256{ 0xf0u } | uint256{ 0x0fu }) == 0xffu);
+static_assert((max_value ^ max_value) == 0u);
+
+// shift
+static_assert((uint256{ 1u } << 255) == high_bit);
+static_assert((high_bit >> 255) == 1u);
+static_assert((uint256{ 1u } << 64) == uint256{ limbs{ 0, 1, 0, 0 } });
+static_assert((uint256{ 1u } << 256) == 0u);
+static_assert((max_value >> 192) == max_uint64);
+
+// addition/subtraction (modular)
+static_assert(max_value + 1u == 0u);
+static_assert(uint256{} - 1u == max_value);
+static_assert(uint256{ max_uint64 } + 1u == uint256{ limbs{ 0, 1, 0, 0 } });
+static_assert(++uint256{ max_value } == 0u);
+static_assert(--uint256{} == max_value);
+
+// multiplication (modular)
+static_assert(uint256{ max_uint64 } * max_uint64 == uint256{ limbs{ 1, sub1(max_uint64), 0, 0 } });
+static_assert(max_value * max_value == 1u);
+static_assert(high_bit * 2u == 0u);
+
+// division
+static_assert(max_value / max_value == 1u);
+static_assert(max_value % max_value == 0u);
+static_assert(uint256{ 42u } / 0u == 0u);
+static_assert(uint256{ 42u } % 0u == 0u);
+static_assert(uint256{ 42u } / 43u == 0u);
+static_assert(uint256{ 42u } % 43u == 42u);
+static_assert(uint256{ 42u } / 5u == 8u);
+static_assert(uint256{ 42u } % 5u == 2u);
+static_assert(max_value / high_bit == 1u);
+static_assert(max_value / uint256{ limbs{ 0, 1, 0, 0 } } == (max_value >> 64));
+static_assert(max_value / 3u * 3u == max_value);
+static_assert(high_bit / max_uint64 == uint256{ limbs{ bit_hi<uint64_t>, bit_hi<uint64_t>, bit_hi<uint64_t>, 0 } });
+
+// proof of work (2^256 / (target + 1)) for mainnet genesis bits.
+static_assert(++(~chain::compact::expand_fixed(0x1d00ffff) / (chain::compact::expand_fixed(0x1d00ffff) + 1u)) == 0x0000000100010001u);
+
+BOOST_AUTO_TEST_CASE(uint256__from_little_endian__to_little_endian__round_trip)
+{
+    const auto value = base16_array("0102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f20");
+    BOOST_REQUIRE_EQUAL(uint256::from_little_endian(value).to_little_endian(), value);
+}
+
+BOOST_AUTO_TEST_CASE(uint256__from_little_endian__hash__expected_to_uintx)
+{
+    const auto hash = base16_hash("000000000019d6689c085ae165831e934ff763ae46a2a6c172b3f1b60a8ce26f");
+    BOOST_REQUIRE(uint256_t{ uint256::from_little_endian(hash) } == to_uintx(hash));
+}
+
+BOOST_AUTO_TEST_CASE(uint256__uint256_t__round_trip__expected)
+{
+    const uint256_t expected{ "0x8000000000000001fedcba9876543210ffffffffffffffff0123456789abcdef" };
+    const uint256 value{ expected };
+    BOOST_REQUIRE(uint256_t{ value } == expected);
+    BOOST_REQUIRE_EQUAL(value.words()[0], 0x0123456789abcdef_u64);
+    BOOST_REQUIRE_EQUAL(value.words()[3], 0x8000000000000001_u64);
+}
+
+BOOST_AUTO_TEST_CASE(uint256__divide__uint256_t__expected)
+{
+    const uint256_t dividend{ "0xfedcba9876543210fedcba9876543210fedcba9876543210fedcba9876543210" };
+    const uint256_t divisor{ "0x00000000000000000123456789abcdef0123456789abcdef" };
+
+    uint256 quotient{};
+    uint256 remainder{};
+    uint256::divide(quotient, remainder, dividend, divisor);
+    BOOST_REQUIRE(uint256_t{ quotient } == dividend / divisor);
+    BOOST_REQUIRE(uint256_t{ remainder } == dividend % divisor);
+}
+
+static void require_divide(const uint256& dividend, const uint256& divisor)
+{
+    const uint256_t expected_dividend{ dividend };
+    const uint256_t expected_divisor{ divisor };
+    BOOST_REQUIRE(uint256_t{ dividend / divisor } == expected_dividend / expected_divisor);
+    BOOST_REQUIRE(uint256_t{ dividend % divisor } == expected_dividend % expected_divisor);
+}
+
+// Quotient digit estimates that remain one too large after correction require
+// the add-back step, which random digits reach only with probability ~2/base.
+BOOST_AUTO_TEST_CASE(uint256__divide__add_back__expected_uint256_t)
+{
+    constexpr auto half = bit_hi<uint64_t>;
+
+    // 64 bit digits: [0, 0, 2^63, 2^63-1] / [1, 0, 2^63].
+    require_divide(uint256{ limbs{ 0, 0, half, sub1(half) } },
+        uint256{ limbs{ 1, 0, half, 0 } });
+
+    // 32 bit digits: [0, 0, 2^31, 2^31-1] / [1, 0, 2^31].
+    require_divide(uint256{ limbs{ 0, 0x7fffffff80000000, 0, 0 } },
+        uint256{ limbs{ 1, 0x80000000, 0, 0 } });
+}
+
+// Random digits are biased to edge values, so that quotient digit correction
+// and add-back are reached (this seed reaches add-back for both digit sizes).
+BOOST_AUTO_TEST_CASE(uint256__divide__randomized__expected_uint256_t)
+{
+    constexpr std_array<uint64_t, 8> edges
+    {
+        0, 1, 2, max_uint64, sub1(max_uint64), bit_hi<uint64_t>,
+        sub1(bit_hi<uint64_t>), add1(bit_hi<uint64_t>)
+    };
+
+    std::mt19937_64 random{ 42 };
+    const auto digit = [&]() NOEXCEPT
+    {
+        return is_zero(random() % 4u) ? random() : edges[random() % edges.size()];
+    };
+
+    const auto value = [&]() NOEXCEPT
+    {
+        limbs words{};
+        const auto count = add1(random() % words.size());
+        for (size_t index = 0; index < count; ++index)
+            words[index] = digit();
+
+        return uint256{ words };
+    };
+
+    for (auto iteration = 0; iteration < 10'000; ++iteration)
+    {
+        const auto dividend = value();
+        const auto divisor = value();
+        if (divisor != 0u)
+            require_divide(dividend, divisor);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(uint256__multiply__uint256_t__expected)
+{
+    const uint256_t left{ "0xfedcba9876543210fedcba9876543210" };
+    const uint256_t right{ "0x0123456789abcdef0123456789abcdef01" };
+    BOOST_REQUIRE(uint256_t{ uint256{ left } * uint256{ right } } == uint256_t{ left * right });
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -280,4 +280,19 @@ BOOST_AUTO_TEST_CASE(settings__sorted_checkpoint__mainnet_default_expected)
     BOOST_REQUIRE_EQUAL(configuration.top_checkpoint(), mainnet_checkpoints.front());
 }
 
+BOOST_AUTO_TEST_CASE(settings__is_under_milestone__mainnet_default__expected)
+{
+    const settings configuration(chain::selection::mainnet);
+    BOOST_REQUIRE(configuration.is_under_milestone(0));
+    BOOST_REQUIRE(configuration.is_under_milestone(900000));
+    BOOST_REQUIRE(!configuration.is_under_milestone(900001));
+}
+
+BOOST_AUTO_TEST_CASE(settings__is_under_milestone__null_milestone__false)
+{
+    settings configuration(chain::selection::mainnet);
+    configuration.milestone = {};
+    BOOST_REQUIRE(!configuration.is_under_milestone(0));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,93 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_FIXTURE_TEST_SUITE(mapped_file_tests, test::directory_setup_fixture)
+
+static void write_file(const std::string& path, const data_chunk& data) NOEXCEPT
+{
+    ofstream out(path, std::ofstream::out | std::ofstream::binary);
+    out.write(pointer_cast<const char>(data.data()), data.size());
+    out.close();
+}
+
+BOOST_AUTO_TEST_CASE(mapped_file__construct__missing_file__invalid)
+{
+    const mapped_file file(TEST_PATH);
+    BOOST_REQUIRE(!file);
+    BOOST_REQUIRE(file.data().empty());
+    BOOST_REQUIRE_EQUAL(file.size(), zero);
+    BOOST_REQUIRE(!file.prefetch(0, 1));
+}
+
+BOOST_AUTO_TEST_CASE(mapped_file__construct__empty_file__invalid)
+{
+    write_file(TEST_PATH, {});
+    const mapped_file file(TEST_PATH);
+    BOOST_REQUIRE(!file);
+    BOOST_REQUIRE_EQUAL(file.size(), zero);
+}
+
+BOOST_AUTO_TEST_CASE(mapped_file__construct__file__expected_data)
+{
+    const auto expected = base16_chunk("0102030405060708090a0b0c0d0e0f");
+    write_file(TEST_PATH, expected);
+
+    const mapped_file file(TEST_PATH, false);
+    BOOST_REQUIRE(file);
+    BOOST_REQUIRE_EQUAL(file.size(), expected.size());
+    BOOST_REQUIRE_EQUAL(file.data(), expected);
+    BOOST_REQUIRE(file.prefetch(1, 100));
+    BOOST_REQUIRE(file.evict(0, file.size()));
+    BOOST_REQUIRE(!file.prefetch(file.size(), 1));
+}
+
+BOOST_AUTO_TEST_CASE(mapped_file__move__file__expected_data)
+{
+    const auto expected = base16_chunk("0102030405060708");
+    write_file(TEST_PATH, expected);
+
+    mapped_file file(TEST_PATH);
+    mapped_file moved(std::move(file));
+    BOOST_REQUIRE(!file);
+    BOOST_REQUIRE(moved);
+    BOOST_REQUIRE_EQUAL(moved.data(), expected);
+
+    mapped_file assigned(TEST_DIRECTORY + "/missing");
+    assigned = std::move(moved);
+    BOOST_REQUIRE(!moved);
+    BOOST_REQUIRE(assigned);
+    BOOST_REQUIRE_EQUAL(assigned.data(), expected);
+}
+
+BOOST_AUTO_TEST_CASE(mapped_file__data__slice_reader__reads_in_place)
+{
+    write_file(TEST_PATH, base16_chunk("ff0102030405060708"));
+
+    const mapped_file file(TEST_PATH);
+    BOOST_REQUIRE(file);
+
+    read::bytes::slice source(file.data());
+    BOOST_REQUIRE_EQUAL(source.read_byte(), 0xff_u8);
+    BOOST_REQUIRE_EQUAL(source.read_8_bytes_little_endian(), 0x0807060504030201_u64);
+    BOOST_REQUIRE(source.is_exhausted());
+    BOOST_REQUIRE(source);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
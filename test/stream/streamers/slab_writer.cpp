@@ -0,0 +1,128 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(slab_writer_tests)
+
+// bool
+
+BOOST_AUTO_TEST_CASE(slab_writer__bool__default__true)
+{
+    data_chunk data(1);
+    write::bytes::slab writer(data);
+    BOOST_REQUIRE(writer);
+    BOOST_REQUIRE(!!writer);
+}
+
+BOOST_AUTO_TEST_CASE(slab_writer__bool__empty_write_nothing__true)
+{
+    data_chunk data{};
+    write::bytes::slab writer(data);
+    writer.write_bytes(data_chunk{});
+    BOOST_REQUIRE(writer);
+}
+
+BOOST_AUTO_TEST_CASE(slab_writer__bool__overflow__false_and_unchanged)
+{
+    data_chunk data{ 0x42 };
+    write::bytes::slab writer(data);
+    writer.write_2_bytes_little_endian(0xabcd);
+    BOOST_REQUIRE(!writer);
+    BOOST_REQUIRE_EQUAL(data, data_chunk{ 0x42 });
+
+    // Invalidation is sticky.
+    writer.write_byte(0xff);
+    BOOST_REQUIRE(!writer);
+    BOOST_REQUIRE_EQUAL(data, data_chunk{ 0x42 });
+    BOOST_REQUIRE_EQUAL(writer.get_write_position(), 0u);
+}
+
+// get_write_position
+
+BOOST_AUTO_TEST_CASE(slab_writer__get_write_position__writes__expected)
+{
+    data_chunk data(3);
+    write::bytes::slab writer(data);
+    BOOST_REQUIRE_EQUAL(writer.get_write_position(), 0u);
+    writer.write_byte('*');
+    BOOST_REQUIRE_EQUAL(writer.get_write_position(), 1u);
+    writer.write_2_bytes_little_endian(0x2a2a);
+    BOOST_REQUIRE_EQUAL(writer.get_write_position(), 3u);
+    BOOST_REQUIRE(writer);
+}
+
+// little endian
+
+BOOST_AUTO_TEST_CASE(slab_writer__write_little_endian__integers__expected)
+{
+    const auto expected = base16_chunk("0201" "06050403" "0e0d0c0b0a090807");
+    data_chunk data(expected.size());
+    write::bytes::slab writer(data);
+    writer.write_2_bytes_little_endian(0x0102);
+    writer.write_4_bytes_little_endian(0x03040506);
+    writer.write_8_bytes_little_endian(0x0708090a0b0c0d0e);
+    BOOST_REQUIRE(writer);
+    BOOST_REQUIRE_EQUAL(data, expected);
+}
+
+// write_variable
+
+BOOST_AUTO_TEST_CASE(slab_writer__write_variable__all_sizes__same_as_byte_writer)
+{
+    constexpr uint64_t values[]{ 0xfc, 0xfd, 0xffff, 0x10000, 0xffffffff, 0x100000000 };
+
+    data_chunk expected{};
+    {
+        write::bytes::data sink(expected);
+        for (const auto value: values)
+            sink.write_variable(value);
+    }
+
+    data_chunk data(expected.size());
+    write::bytes::slab writer(data);
+    for (const auto value: values)
+        writer.write_variable(value);
+
+    BOOST_REQUIRE(writer);
+    BOOST_REQUIRE_EQUAL(data, expected);
+}
+
+// write_bytes
+
+BOOST_AUTO_TEST_CASE(slab_writer__write_bytes__slice__expected)
+{
+    const auto expected = base16_chunk("00010203040506070809");
+    data_chunk data(expected.size());
+    write::bytes::slab writer(data);
+    writer.write_bytes(expected);
+    BOOST_REQUIRE(writer);
+    BOOST_REQUIRE_EQUAL(data, expected);
+}
+
+BOOST_AUTO_TEST_CASE(slab_writer__write_bytes__pointer__expected)
+{
+    const auto expected = base16_chunk("00010203040506070809");
+    data_chunk data(expected.size());
+    write::bytes::slab writer(data.data(), data.size());
+    writer.write_bytes(expected.data(), expected.size());
+    BOOST_REQUIRE(writer);
+    BOOST_REQUIRE_EQUAL(data, expected);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
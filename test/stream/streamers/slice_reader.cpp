@@ -0,0 +1,195 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(slice_reader_tests)
+
+// bool
+
+BOOST_AUTO_TEST_CASE(slice_reader__bool__default__true)
+{
+    const data_chunk data{ 0x42 };
+    read::bytes::slice reader(data);
+    BOOST_REQUIRE(reader);
+    BOOST_REQUIRE(!!reader);
+}
+
+BOOST_AUTO_TEST_CASE(slice_reader__bool__empty_read_nothing__true)
+{
+    const data_chunk data{};
+    read::bytes::slice reader(data);
+    reader.skip_bytes(0);
+    BOOST_REQUIRE(reader);
+    BOOST_REQUIRE(reader.is_exhausted());
+}
+
+BOOST_AUTO_TEST_CASE(slice_reader__bool__underflow__false_unmoved_zero)
+{
+    const data_chunk data{ 0x42 };
+    read::bytes::slice reader(data);
+    BOOST_REQUIRE_EQUAL(reader.read_2_bytes_little_endian(), 0u);
+    BOOST_REQUIRE(!reader);
+    BOOST_REQUIRE_EQUAL(reader.get_read_position(), 0u);
+
+    // Invalidation is sticky.
+    BOOST_REQUIRE_EQUAL(reader.read_byte(), 0x00u);
+    BOOST_REQUIRE(!reader);
+    BOOST_REQUIRE(reader.is_exhausted());
+}
+
+// set_position
+
+BOOST_AUTO_TEST_CASE(slice_reader__set_position__after_underflow__valid)
+{
+    const data_chunk data{ 0x01, 0x02 };
+    read::bytes::slice reader(data);
+    reader.skip_byte();
+    reader.read_4_bytes_little_endian();
+    BOOST_REQUIRE(!reader);
+    reader.set_position(0);
+    BOOST_REQUIRE(reader);
+    BOOST_REQUIRE_EQUAL(reader.read_2_bytes_little_endian(), 0x0201u);
+}
+
+BOOST_AUTO_TEST_CASE(slice_reader__set_position__beyond_end__false)
+{
+    const data_chunk data{ 0x01, 0x02 };
+    read::bytes::slice reader(data);
+    reader.set_position(3);
+    BOOST_REQUIRE(!reader);
+}
+
+// set_limit
+
+BOOST_AUTO_TEST_CASE(slice_reader__set_limit__limited_read__false_until_reset)
+{
+    const data_chunk data{ 0x01, 0x02, 0x03, 0x04 };
+    read::bytes::slice reader(data);
+    reader.skip_byte();
+    reader.set_limit(2);
+    BOOST_REQUIRE_EQUAL(reader.read_2_bytes_little_endian(), 0x0302u);
+    BOOST_REQUIRE(reader.is_exhausted());
+    BOOST_REQUIRE(reader);
+
+    reader.read_byte();
+    BOOST_REQUIRE(!reader);
+    reader.set_limit();
+    reader.set_position(3);
+    BOOST_REQUIRE_EQUAL(reader.read_byte(), 0x04u);
+    BOOST_REQUIRE(reader);
+}
+
+BOOST_AUTO_TEST_CASE(slice_reader__read_bytes_raw__limited__remaining_to_limit)
+{
+    const data_chunk data{ 0x01, 0x02, 0x03, 0x04 };
+    read::bytes::slice reader(data);
+    reader.skip_byte();
+    reader.set_limit(2);
+    const auto raw = reader.read_bytes_raw();
+    BOOST_REQUIRE(reader);
+    BOOST_REQUIRE(raw != nullptr);
+    BOOST_REQUIRE_EQUAL(*raw, (data_chunk{ 0x02, 0x03 }));
+    reader.get_allocator().delete_object<data_chunk>(raw);
+}
+
+// integrals
+
+BOOST_AUTO_TEST_CASE(slice_reader__read_little_endian__integers__expected)
+{
+    const auto data = base16_chunk("0201" "06050403" "0e0d0c0b0a090807");
+    read::bytes::slice reader(data);
+    BOOST_REQUIRE_EQUAL(reader.read_2_bytes_little_endian(), 0x0102u);
+    BOOST_REQUIRE_EQUAL(reader.read_4_bytes_little_endian(), 0x03040506u);
+    BOOST_REQUIRE_EQUAL(reader.read_8_bytes_little_endian(),
+        0x0708090a0b0c0d0e_u64);
+    BOOST_REQUIRE(reader.is_exhausted());
+    BOOST_REQUIRE(reader);
+}
+
+BOOST_AUTO_TEST_CASE(slice_reader__read_variable__all_widths__expected)
+{
+    const auto data = base16_chunk(
+        "fc" "fd0201" "fe06050403" "ff0e0d0c0b0a090807");
+    read::bytes::slice reader(data);
+    BOOST_REQUIRE_EQUAL(reader.read_variable(), 0xfcu);
+    BOOST_REQUIRE_EQUAL(reader.read_variable(), 0x0102u);
+    BOOST_REQUIRE_EQUAL(reader.read_variable(), 0x03040506u);
+    BOOST_REQUIRE_EQUAL(reader.read_variable(), 0x0708090a0b0c0d0e_u64);
+    BOOST_REQUIRE(reader);
+}
+
+BOOST_AUTO_TEST_CASE(slice_reader__read_variable__padded_widths__expected_positions)
+{
+    // Trailing bytes cause each width to be read by a masked full load.
+    const auto data = base16_chunk(
+        "fc" "fd0201" "fe06050403" "ff0e0d0c0b0a090807" "ffffffffffffffffff");
+    read::bytes::slice reader(data);
+    BOOST_REQUIRE_EQUAL(reader.read_variable(), 0xfcu);
+    BOOST_REQUIRE_EQUAL(reader.get_read_position(), 1u);
+    BOOST_REQUIRE_EQUAL(reader.read_variable(), 0x0102u);
+    BOOST_REQUIRE_EQUAL(reader.get_read_position(), 4u);
+    BOOST_REQUIRE_EQUAL(reader.read_variable(), 0x03040506u);
+    BOOST_REQUIRE_EQUAL(reader.get_read_position(), 9u);
+    BOOST_REQUIRE_EQUAL(reader.read_variable(), 0x0708090a0b0c0d0e_u64);
+    BOOST_REQUIRE_EQUAL(reader.get_read_position(), 18u);
+    BOOST_REQUIRE(reader);
+}
+
+BOOST_AUTO_TEST_CASE(slice_reader__read_variable__truncated__zero_false)
+{
+    const auto data = base16_chunk("fe060504");
+    read::bytes::slice reader(data);
+    BOOST_REQUIRE_EQUAL(reader.read_variable(), 0u);
+    BOOST_REQUIRE(!reader);
+}
+
+BOOST_AUTO_TEST_CASE(slice_reader__read_size__exceeds_limit__zero_false)
+{
+    const data_chunk data{ 0x2a };
+    read::bytes::slice reader(data);
+    BOOST_REQUIRE_EQUAL(reader.read_size(41), 0u);
+    BOOST_REQUIRE(!reader);
+}
+
+// bytes
+
+BOOST_AUTO_TEST_CASE(slice_reader__read_pointer__sufficient__expected_advanced)
+{
+    const data_chunk data{ 0x01, 0x02, 0x03 };
+    read::bytes::slice reader(data);
+    reader.skip_byte();
+    const auto pointer = reader.read_pointer(2);
+    BOOST_REQUIRE(reader);
+    BOOST_REQUIRE(pointer == std::next(data.data()));
+    BOOST_REQUIRE(reader.is_exhausted());
+    BOOST_REQUIRE(reader.read_pointer(1) == nullptr);
+    BOOST_REQUIRE(!reader);
+}
+
+BOOST_AUTO_TEST_CASE(slice_reader__peek_byte__exhausted__zero_false)
+{
+    const data_chunk data{ 0x2a };
+    read::bytes::slice reader(data);
+    BOOST_REQUIRE_EQUAL(reader.peek_byte(), 0x2au);
+    BOOST_REQUIRE_EQUAL(reader.read_byte(), 0x2au);
+    BOOST_REQUIRE_EQUAL(reader.peek_byte(), 0x00u);
+    BOOST_REQUIRE(!reader);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,109 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(tee_writer_tests)
+
+// bool
+
+BOOST_AUTO_TEST_CASE(tee_writer__bool__default__true)
+{
+    data_chunk data(1);
+    write::bytes::tee writer(data, true);
+    BOOST_REQUIRE(writer);
+    BOOST_REQUIRE(!!writer);
+}
+
+BOOST_AUTO_TEST_CASE(tee_writer__bool__overflow__false_and_unchanged)
+{
+    data_chunk data{ 0x42 };
+    write::bytes::tee writer(data, true);
+    writer.write_2_bytes_little_endian(0xabcd);
+    BOOST_REQUIRE(!writer);
+    BOOST_REQUIRE_EQUAL(data, data_chunk{ 0x42 });
+    BOOST_REQUIRE_EQUAL(writer.get_write_position(), 0u);
+}
+
+// write
+
+BOOST_AUTO_TEST_CASE(tee_writer__write__integers_and_bytes__expected)
+{
+    const auto expected = base16_chunk("0201" "06050403" "fdffff" "2a" "babe");
+    data_chunk data(expected.size());
+    write::bytes::tee writer(data, false);
+    writer.write_2_bytes_little_endian(0x0102);
+    writer.write_4_bytes_little_endian(0x03040506);
+    writer.write_variable(0xffff);
+    writer.write_byte(0x2a);
+    writer.write_bytes(base16_chunk("babe"));
+    BOOST_REQUIRE(writer);
+    BOOST_REQUIRE_EQUAL(writer.get_write_position(), expected.size());
+    BOOST_REQUIRE_EQUAL(data, expected);
+}
+
+// hashes
+
+BOOST_AUTO_TEST_CASE(tee_writer__hashes__no_witness__equal)
+{
+    const auto expected = base16_chunk("000102030405060708090a0b0c0d0e0f");
+    data_chunk data(expected.size());
+    write::bytes::tee writer(data, true);
+    writer.write_bytes(expected);
+    BOOST_REQUIRE_EQUAL(writer.nominal_hash(), bitcoin_hash(expected));
+    BOOST_REQUIRE_EQUAL(writer.witness_hash(), bitcoin_hash(expected));
+}
+
+BOOST_AUTO_TEST_CASE(tee_writer__hashes__witness_section__excluded_from_nominal)
+{
+    const auto nominal = base16_chunk("00010203" "0c0d0e0f");
+    const auto witnessed = base16_chunk("00010203" "04050607" "0c0d0e0f");
+    data_chunk data(witnessed.size());
+    write::bytes::tee writer(data, true);
+    writer.write_bytes(base16_chunk("00010203"));
+    writer.begin_witness();
+    writer.write_bytes(base16_chunk("04050607"));
+    writer.end_witness();
+    writer.write_bytes(base16_chunk("0c0d0e0f"));
+    BOOST_REQUIRE_EQUAL(data, witnessed);
+    BOOST_REQUIRE_EQUAL(writer.nominal_hash(), bitcoin_hash(nominal));
+    BOOST_REQUIRE_EQUAL(writer.witness_hash(), bitcoin_hash(witnessed));
+}
+
+BOOST_AUTO_TEST_CASE(tee_writer__witness_hash__disabled__null_hash)
+{
+    data_chunk data(1);
+    write::bytes::tee writer(data, false);
+    writer.write_byte(0x2a);
+    BOOST_REQUIRE_EQUAL(writer.nominal_hash(), bitcoin_hash(data));
+    BOOST_REQUIRE_EQUAL(writer.witness_hash(), null_hash);
+}
+
+BOOST_AUTO_TEST_CASE(tee_writer__nominal_hash__repeated__unchanged)
+{
+    data_chunk data(2);
+    write::bytes::tee writer(data, false);
+    writer.write_byte(0x2a);
+    const auto first = writer.nominal_hash();
+    BOOST_REQUIRE_EQUAL(writer.nominal_hash(), first);
+
+    writer.write_byte(0x2b);
+    BOOST_REQUIRE_EQUAL(writer.nominal_hash(), bitcoin_hash(data));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,94 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(word_bit_reader_tests)
+
+BOOST_AUTO_TEST_CASE(word_bit_reader__read_bit__high_order_first__expected)
+{
+    const data_chunk data{ 0xa0 };
+    read::bits::word reader(data);
+    BOOST_REQUIRE(reader.read_bit());
+    BOOST_REQUIRE(!reader.read_bit());
+    BOOST_REQUIRE(reader.read_bit());
+    BOOST_REQUIRE(!reader.read_bit());
+    BOOST_REQUIRE(reader);
+    BOOST_REQUIRE(!reader.is_exhausted());
+}
+
+BOOST_AUTO_TEST_CASE(word_bit_reader__read_bits__empty__zero_invalid)
+{
+    const data_chunk data{};
+    read::bits::word reader(data);
+    BOOST_REQUIRE(reader.is_exhausted());
+    BOOST_REQUIRE_EQUAL(reader.read_bits(1), 0u);
+    BOOST_REQUIRE(!reader);
+}
+
+BOOST_AUTO_TEST_CASE(word_bit_reader__read_bits__unaligned_across_words__expected)
+{
+    const auto data = base16_chunk("0123456789abcdeffedcba9876543210");
+    read::bits::word reader(data);
+    BOOST_REQUIRE_EQUAL(reader.read_bits(4), 0x0u);
+    BOOST_REQUIRE_EQUAL(reader.read_bits(19), 0x091a2u);
+    BOOST_REQUIRE_EQUAL(reader.read_bits(64), 0xb3c4d5e6f7ff6e5d_u64);
+    BOOST_REQUIRE_EQUAL(reader.read_bits(41), 0x9876543210_u64);
+    BOOST_REQUIRE(reader.is_exhausted());
+    BOOST_REQUIRE(reader);
+}
+
+BOOST_AUTO_TEST_CASE(word_bit_reader__read_bits__bit_reader__same_values)
+{
+    data_chunk data(100);
+    for (size_t index = 0; index < data.size(); ++index)
+        data[index] = narrow_cast<uint8_t>(index * 37 + 11);
+
+    read::bits::copy expected(data);
+    read::bits::word reader(data);
+    for (size_t bits = 0; bits <= 30; ++bits)
+        BOOST_REQUIRE_EQUAL(reader.read_bits(bits), expected.read_bits(bits));
+
+    BOOST_REQUIRE(reader);
+}
+
+BOOST_AUTO_TEST_CASE(word_bit_reader__read_unary__runs__expected)
+{
+    // 0 | 10 | 110 | (70 ones) 0 | padding
+    data_chunk data{ 0x5b };
+    data.resize(10, 0xff);
+    data.push_back(0xfc);
+    data.push_back(0x00);
+    read::bits::word reader(data);
+    BOOST_REQUIRE_EQUAL(reader.read_unary(), 0u);
+    BOOST_REQUIRE_EQUAL(reader.read_unary(), 1u);
+    BOOST_REQUIRE_EQUAL(reader.read_unary(), 2u);
+    BOOST_REQUIRE_EQUAL(reader.read_unary(), 2u + 72u + 6u);
+    BOOST_REQUIRE(reader);
+}
+
+BOOST_AUTO_TEST_CASE(word_bit_reader__read_unary__unterminated__zero_invalid)
+{
+    const data_chunk data{ 0xff, 0xff };
+    read::bits::word reader(data);
+    BOOST_REQUIRE_EQUAL(reader.read_unary(), 0u);
+    BOOST_REQUIRE(!reader);
+    BOOST_REQUIRE(reader.is_exhausted());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,92 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(word_bit_writer_tests)
+
+BOOST_AUTO_TEST_CASE(word_bit_writer__write_bit__flush__high_order_first_padded)
+{
+    data_chunk data{};
+    write::bits::word writer(data);
+    writer.write_bit(true);
+    writer.write_bit(false);
+    writer.write_bit(true);
+    BOOST_REQUIRE(data.empty());
+    writer.flush();
+    BOOST_REQUIRE_EQUAL(data, data_chunk{ 0xa0 });
+}
+
+BOOST_AUTO_TEST_CASE(word_bit_writer__destruct__flushes)
+{
+    data_chunk data{ 0x42 };
+    {
+        write::bits::word writer(data);
+        writer.write_bits(0x0f, 4);
+    }
+
+    BOOST_REQUIRE_EQUAL(data, (data_chunk{ 0x42, 0xf0 }));
+}
+
+BOOST_AUTO_TEST_CASE(word_bit_writer__write_bits__unaligned_across_words__expected)
+{
+    data_chunk data{};
+    write::bits::word writer(data);
+    writer.write_bits(0x0, 4);
+    writer.write_bits(0x091a2, 19);
+    writer.write_bits(0xb3c4d5e6f7ff6e5d_u64, 64);
+    writer.write_bits(0x9876543210_u64, 41);
+    writer.flush();
+    BOOST_REQUIRE_EQUAL(data, base16_chunk("0123456789abcdeffedcba9876543210"));
+}
+
+BOOST_AUTO_TEST_CASE(word_bit_writer__write_unary__runs__expected)
+{
+    data_chunk expected{ 0x5b };
+    expected.resize(10, 0xff);
+    expected.push_back(0xfc);
+
+    data_chunk data{};
+    write::bits::word writer(data);
+    writer.write_unary(0);
+    writer.write_unary(1);
+    writer.write_unary(2);
+    writer.write_unary(80);
+    writer.flush();
+    BOOST_REQUIRE_EQUAL(data, expected);
+}
+
+BOOST_AUTO_TEST_CASE(word_bit_writer__write_bits__bit_writer__same_data)
+{
+    data_chunk expected{};
+    {
+        write::bits::data writer(expected);
+        for (size_t bits = 0; bits <= 64; ++bits)
+            writer.write_bits(bits * 0x0123456789abcdef_u64, bits);
+    }
+
+    data_chunk data{};
+    write::bits::word writer(data);
+    for (size_t bits = 0; bits <= 64; ++bits)
+        writer.write_bits(bits * 0x0123456789abcdef_u64, bits);
+
+    writer.flush();
+    BOOST_REQUIRE_EQUAL(data, expected);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -141,6 +141,40 @@ BOOST_AUTO_TEST_CASE(neutrino__compute_header__block_3__success)
     BOOST_REQUIRE_EQUAL(result, expected);
 }
 
+BOOST_AUTO_TEST_CASE(neutrino__compute_headers__blocks_2_3__expected)
+{
+    const auto previous_header = base16_hash("d7bdac13a59d745b1add0d2ce852f1a0442e8945fc1bf3848d3cbffd88c24fe1");
+    const data_stack filters{ base16_chunk("0174a170"), base16_chunk("016cf7a0") };
+    const hashes expected
+    {
+        base16_hash("186afd11ef2b5e7e3504f2e8cbf8df28a1fd251fe53d60dff8b1467d1b386cf0"),
+        base16_hash("8d63aadf5ab7257cb6d2316a57b16f517bff1c6388f124ec4c04af1212729d2a")
+    };
+
+    hashes filter_hashes{};
+    const auto result = neutrino::compute_headers(filter_hashes, previous_header, filters);
+    BOOST_REQUIRE_EQUAL(result, expected);
+    BOOST_REQUIRE_EQUAL(filter_hashes.size(), filters.size());
+    BOOST_REQUIRE_EQUAL(filter_hashes.front(), bitcoin_hash(filters.front()));
+    BOOST_REQUIRE_EQUAL(filter_hashes.back(), bitcoin_hash(filters.back()));
+}
+
+BOOST_AUTO_TEST_CASE(neutrino__compute_headers__resumed__expected)
+{
+    const auto previous_header = base16_hash("d7bdac13a59d745b1add0d2ce852f1a0442e8945fc1bf3848d3cbffd88c24fe1");
+    const auto first = neutrino::compute_headers(previous_header, { base16_chunk("0174a170") });
+    BOOST_REQUIRE_EQUAL(first.size(), one);
+
+    const auto second = neutrino::compute_headers(first.back(), { base16_chunk("016cf7a0") });
+    BOOST_REQUIRE_EQUAL(second.size(), one);
+    BOOST_REQUIRE_EQUAL(second.front(), base16_hash("8d63aadf5ab7257cb6d2316a57b16f517bff1c6388f124ec4c04af1212729d2a"));
+}
+
+BOOST_AUTO_TEST_CASE(neutrino__compute_headers__empty__empty)
+{
+    BOOST_REQUIRE(neutrino::compute_headers(null_hash, data_stack{}).empty());
+}
+
 BOOST_AUTO_TEST_CASE(neutrino__compute_header__block_15007__success)
 {
     const auto expected = base16_hash("07384b01311867949e0c046607c66b7a766d338474bb67f66c8ae9dbd454b20e");
@@ -2935,6 +2969,48 @@ BOOST_AUTO_TEST_CASE(neutrino__compute_filter__block_3__success)
     BOOST_REQUIRE_EQUAL(result, expected_filter);
 }
 
+BOOST_AUTO_TEST_CASE(neutrino__compute_filters__blocks_0_2_3__expected_in_order)
+{
+    const chain::blocks blocks
+    {
+        chain::block(base16_chunk(
+            "01000000000000000000000000000000000000000000000000000000000000000000"
+            "00003ba3edfd7a7b12b27ac72c3e67768f617fc81bc3888a51323a9fb8aa4b1e5e4a"
+            "dae5494dffff001d1aa4ae1801010000000100000000000000000000000000000000"
+            "00000000000000000000000000000000ffffffff4d04ffff001d0104455468652054"
+            "696d65732030332f4a616e2f32303039204368616e63656c6c6f72206f6e20627269"
+            "6e6b206f66207365636f6e64206261696c6f757420666f722062616e6b73ffffffff"
+            "0100f2052a01000000434104678afdb0fe5548271967f1a67130b7105cd6a828e039"
+            "09a67962e0ea1f61deb649f6bc3f4cef38c4f35504e51ec112de5c384df7ba0b8d57"
+            "8a4c702b6bf11d5fac00000000"), true),
+        chain::block(base16_chunk(
+            "0100000006128e87be8b1b4dea47a7247d5528d2702c96826c7a648497e773b80000"
+            "0000e241352e3bec0a95a6217e10c3abb54adfa05abb12c126695595580fb92e2220"
+            "32e7494dffff001d00d2353401010000000100000000000000000000000000000000"
+            "00000000000000000000000000000000ffffffff0e0432e7494d010e062f50325348"
+            "2fffffffff0100f2052a010000002321038a7f6ef1c8ca0c588aa53fa860128077c9"
+            "e6c11e6830f4d7ee4e763a56b7718fac00000000"), true),
+        chain::block(base16_chunk(
+            "0100000020782a005255b657696ea057d5b98f34defcf75196f64f6eeac8026c0000"
+            "000041ba5afc532aae03151b8aa87b65e1594f97504a768e010c98c0add792162471"
+            "86e7494dffff001d058dc2b601010000000100000000000000000000000000000000"
+            "00000000000000000000000000000000ffffffff0e0486e7494d0151062f50325348"
+            "2fffffffff0100f2052a01000000232103f6d9ff4c12959445ca5549c811683bf9c8"
+            "8e637b222dd2e0311154c4c85cf423ac00000000"), true)
+    };
+
+    const data_stack expected
+    {
+        base16_chunk("019dfca8"),
+        base16_chunk("0174a170"),
+        base16_chunk("016cf7a0")
+    };
+
+    data_stack result{};
+    BOOST_REQUIRE(neutrino::compute_filters(result, blocks));
+    BOOST_REQUIRE_EQUAL(result, expected);
+}
+
 BOOST_AUTO_TEST_CASE(neutrino__compute_filter__block_15007__success)
 {
     // const auto expected_block_hash = base16_hash("0000000038c44c703bae0f98cdd6bf30922326340a5996cc692aaae8bacf47ad");
@@ -3594,4 +3670,68 @@ BOOST_AUTO_TEST_CASE(neutrino__match_filter_2__unrelated_address__false)
     BOOST_REQUIRE(!neutrino::match_filter(filter, addresses));
 }
 
+BOOST_AUTO_TEST_CASE(neutrino__rescan__matching_filters__expected_heights)
+{
+    const neutrino::block_filter empty
+    {
+        base16_hash("00000000fd3ceb2404ff07a785c7fdcc76619edc8ed61bd25134eaa22084366a"),
+        base16_chunk("00")
+    };
+
+    const neutrino::block_filter filter
+    {
+        base16_hash("00000000fd3ceb2404ff07a785c7fdcc76619edc8ed61bd25134eaa22084366a"),
+        base16_chunk("0db414c859a07e8205876354a210a75042d0463404913d61a8e068e58a3ae2aa080026")
+    };
+
+    const wallet::payment_address::list addresses
+    {
+        {
+            base16_array("001fa7459a6cfc64bdc100ba700a21003b005000"),
+            wallet::payment_address::testnet_p2kh
+        },
+        {
+            base16_array("001fa7459a6cfc64bdc178ba7e7a21603bb2568f"),
+            wallet::payment_address::testnet_p2kh
+        }
+    };
+
+    const neutrino::block_filters filters{ empty, filter, empty, filter };
+    const neutrino::heights expected{ 101, 103 };
+    BOOST_REQUIRE(neutrino::rescan(filters, 100, addresses) == expected);
+}
+
+BOOST_AUTO_TEST_CASE(neutrino__rescan__unrelated_address__empty)
+{
+    const neutrino::block_filter filter
+    {
+        base16_hash("00000000fd3ceb2404ff07a785c7fdcc76619edc8ed61bd25134eaa22084366a"),
+        base16_chunk("0db414c859a07e8205876354a210a75042d0463404913d61a8e068e58a3ae2aa080026")
+    };
+
+    const wallet::payment_address::list addresses
+    {
+        {
+            base16_array("001fa7459a6cfc64bdc100ba700a21003b005000"),
+            wallet::payment_address::testnet_p2kh
+        }
+    };
+
+    const neutrino::block_filters filters{ filter, filter };
+    BOOST_REQUIRE(neutrino::rescan(filters, 0, addresses).empty());
+}
+
+BOOST_AUTO_TEST_CASE(neutrino__rescan__no_scripts__empty)
+{
+    const neutrino::block_filters filters
+    {
+        {
+            base16_hash("00000000fd3ceb2404ff07a785c7fdcc76619edc8ed61bd25134eaa22084366a"),
+            base16_chunk("0db414c859a07e8205876354a210a75042d0463404913d61a8e068e58a3ae2aa080026")
+        }
+    };
+
+    BOOST_REQUIRE(neutrino::rescan(filters, 0, chain::scripts{}).empty());
+}
+
 BOOST_AUTO_TEST_SUITE_END()